@@ -0,0 +1,206 @@
+/**
+ * @file bootloader.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 21:20
+ * @brief Serial bootloader. It runs from the 1 KB boot section and talks to
+ * tools/flasher/sdk_flash.py through USART0 at 1 Mbaud, 8N1.
+ *
+ * Commands, multi-byte values are little-endian:
+ * - 'S': sync, replies 'K', the device signature and the page size.
+ * - 'C' addr: replies 'K' and the CRC of the flash page at addr.
+ * - 'W' addr data crc: programs a page if crc matches the received data and
+ *   replies 'K' and the CRC read back from flash.
+ * - 'Q': replies 'K' and starts the application.
+ * Invalid commands or addresses are answered with 'E'.
+ *
+ * Once the host has been detected, the watchdog resets the device if no byte
+ * is received for one second, so a host that stops in the middle of a command
+ * does not leave the bootloader blocked. After the reset the application is
+ * started if there is one.
+ */
+
+// The bootloader does not use interrupts, blocking calls must poll
+#undef SDK_SLEEP_WAIT
+
+#include <avr/io.h>
+#include <avr/boot.h>
+#include <avr/pgmspace.h>
+#include <avr/wdt.h>
+#include <util/crc16.h>
+#include "drivers/usart_async.h"
+
+#ifndef F_CPU
+#define F_CPU 16000000ul
+#warning "Using F_CPU=16000000ul for baud rate calculation as it has not been defined."
+#endif /* !F_CPU */
+
+#define BOOTLOADER_BAUD_RATE 1000000ul
+#define BOOTLOADER_UBRR (F_CPU / (16 * BOOTLOADER_BAUD_RATE) - 1)
+
+#if F_CPU % (16 * BOOTLOADER_BAUD_RATE) != 0
+#error "F_CPU can not generate the bootloader baud rate without error."
+#endif
+
+/**
+ * @brief First byte address of the boot section, it must match the address
+ * given to the linker.
+ */
+#ifndef BOOTLOADER_START
+#define BOOTLOADER_START 0x7C00u
+#endif /* !BOOTLOADER_START */
+
+/**
+ * @brief Timer/Counter 1 counts at clk/1024, wait about half a second for the
+ * host before starting the application.
+ */
+#define BOOTLOADER_TIMEOUT ((uint16_t)(F_CPU / 1024 / 2))
+
+#define REPLY_OK 'K'
+#define REPLY_ERROR 'E'
+
+static uint8_t page[SPM_PAGESIZE];
+
+/**
+ * @brief Receives a byte and restarts the receive timeout.
+ */
+static uint8_t receive_byte(void)
+{
+    uint8_t data = usart_receive();
+    wdt_reset();
+    return data;
+}
+
+static uint16_t receive_word(void)
+{
+    uint16_t low = receive_byte();
+    return low | ((uint16_t)receive_byte() << 8);
+}
+
+static void transmit_word(uint16_t word)
+{
+    usart_transmit((uint8_t)word);
+    usart_transmit((uint8_t)(word >> 8));
+}
+
+static uint16_t flash_page_crc(uint16_t address)
+{
+    uint16_t crc = 0;
+    for (uint16_t i = 0; i < SPM_PAGESIZE; i++)
+    {
+        crc = _crc_xmodem_update(crc, pgm_read_byte(address + i));
+    }
+    return crc;
+}
+
+static bool valid_page(uint16_t address)
+{
+    return (address % SPM_PAGESIZE) == 0 && address < BOOTLOADER_START;
+}
+
+static void write_page(uint16_t address)
+{
+    boot_page_erase(address);
+    boot_spm_busy_wait();
+    for (uint16_t i = 0; i < SPM_PAGESIZE; i += 2)
+    {
+        boot_page_fill(address + i, page[i] | ((uint16_t)page[i + 1] << 8));
+    }
+    boot_page_write(address);
+    boot_spm_busy_wait();
+    // Make the application section readable again
+    boot_rww_enable();
+}
+
+static void start_application(void)
+{
+    wdt_disable();
+    UCSR0B = 0;
+    UCSR0A = 0;
+    TCCR1B = 0;
+    TCNT1 = 0;
+    __asm__ volatile("jmp 0");
+}
+
+/**
+ * @brief Waits for the first byte sent by the host.
+ * @return false if the timeout expired.
+ */
+static bool wait_for_host(void)
+{
+    TCNT1 = 0;
+    TCCR1B = _BV(CS12) | _BV(CS10);
+    while (TCNT1 < BOOTLOADER_TIMEOUT)
+    {
+        if (bit_is_set(UCSR0A, RXC0)) return true;
+    }
+    return false;
+}
+
+int main(void)
+{
+    MCUSR = 0;
+    wdt_disable();
+
+    UBRR0 = BOOTLOADER_UBRR;
+    UCSR0C = USART_8_BITS | USART_ONE_STOP_BIT | USART_NO_PARITY;
+    UCSR0B = _BV(TXEN0) | _BV(RXEN0);
+
+    bool application = pgm_read_word(0) != 0xFFFF;
+    if (!wait_for_host() && application) start_application();
+    wdt_enable(WDTO_1S);
+
+    while (true)
+    {
+        uint8_t command = receive_byte();
+        if (command == 'S')
+        {
+            usart_transmit(REPLY_OK);
+            usart_transmit(SIGNATURE_0);
+            usart_transmit(SIGNATURE_1);
+            usart_transmit(SIGNATURE_2);
+            usart_transmit(SPM_PAGESIZE);
+        }
+        else if (command == 'C')
+        {
+            uint16_t address = receive_word();
+            if (!valid_page(address))
+            {
+                usart_transmit(REPLY_ERROR);
+                continue;
+            }
+            usart_transmit(REPLY_OK);
+            transmit_word(flash_page_crc(address));
+        }
+        else if (command == 'W')
+        {
+            uint16_t address = receive_word();
+            uint16_t crc = 0;
+            for (uint16_t i = 0; i < SPM_PAGESIZE; i++)
+            {
+                page[i] = receive_byte();
+                crc = _crc_xmodem_update(crc, page[i]);
+            }
+            if (receive_word() != crc || !valid_page(address))
+            {
+                usart_transmit(REPLY_ERROR);
+                continue;
+            }
+            write_page(address);
+            usart_transmit(REPLY_OK);
+            transmit_word(flash_page_crc(address));
+        }
+        else if (command == 'Q')
+        {
+            // Wait until the reply has left the shift register
+            UCSR0A |= _BV(TXC0);
+            usart_transmit(REPLY_OK);
+            loop_until_bit_is_set(UCSR0A, TXC0);
+            start_application();
+        }
+        else
+        {
+            usart_transmit(REPLY_ERROR);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file event_loop.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 11:30
+ * @brief This example program runs three independent activities on the event
+ * scheduler: it echoes bytes received through USART0, blinks an LED connected
+ * to PB5 and reports through USART0 whenever a button connected to PD2
+ * changes its state.
+ *
+ * Handlers must not block, so output is queued and drained one byte per tick
+ * by a low priority event, which keeps up with the 9600 baud line rate.
+ */
+#include "drivers/io_pin.h"
+#include "drivers/usart_async.h"
+#include "system/scheduler.h"
+
+#define BAUD_RATE 9600
+#define BLINK_PERIOD SCHEDULER_MS(500)
+
+/**
+ * @brief Output queue size, it must be a power of two.
+ */
+#define TX_QUEUE_SIZE 32
+#define TX_QUEUE_MASK (TX_QUEUE_SIZE - 1)
+
+// Only accessed from event handlers, which never preempt each other
+static uint8_t tx_queue[TX_QUEUE_SIZE];
+static uint8_t tx_head;
+static uint8_t tx_tail;
+static bool tx_draining;
+
+/**
+ * @brief Sends the next queued byte when the transmitter can take it and
+ * comes back on the next tick while there is output left.
+ */
+static void on_tx_ready(uint8_t arg)
+{
+    if (tx_head != tx_tail && bit_is_set(UCSR0A, UDRE0))
+    {
+        UDR0 = tx_queue[tx_head];
+        tx_head = (tx_head + 1) & TX_QUEUE_MASK;
+    }
+    // If the event can not be posted the next queued byte restarts draining
+    tx_draining =
+        tx_head != tx_tail &&
+        scheduler_post_delayed(on_tx_ready, arg, EVENT_PRIORITY_LOW, 1);
+}
+
+/**
+ * @brief Queues a byte for transmission, it is dropped if the queue is full.
+ */
+static void queue_byte(uint8_t data)
+{
+    uint8_t next = (tx_tail + 1) & TX_QUEUE_MASK;
+    if (next == tx_head) return;
+    tx_queue[tx_tail] = data;
+    tx_tail = next;
+    if (!tx_draining)
+    {
+        tx_draining = scheduler_post(on_tx_ready, 0, EVENT_PRIORITY_LOW);
+    }
+}
+
+static void queue_string(const char *str)
+{
+    while (*str) queue_byte((uint8_t)*str++);
+}
+
+static void on_byte_received(uint8_t data)
+{
+    queue_byte(data);
+}
+
+static void on_blink(uint8_t arg)
+{
+    pin_toggle(PIN_B5);
+    scheduler_post_delayed(on_blink, arg, EVENT_PRIORITY_LOW, BLINK_PERIOD);
+}
+
+static void on_button_changed(uint8_t port_value)
+{
+    queue_string(port_value & _BV(IO_PIN2) ? "released\n" : "pressed\n");
+}
+
+SCHEDULER_EVENT_SOURCE(USART_RX_vect, on_byte_received, EVENT_PRIORITY_HIGH,
+                       UDR0)
+SCHEDULER_EVENT_SOURCE(PCINT2_vect, on_button_changed, EVENT_PRIORITY_NORMAL,
+                       PIND)
+
+int main(void)
+{
+    // Configure RX pin
+    struct pin_config rx_pin = {
+        .pin = PIN_RXD,
+        .dir = INPUT,
+        .pull_up = PULL_UP_DISABLED,
+        .value = LOW
+    };
+    pin_configure(rx_pin);
+
+    // Configure TX pin
+    struct pin_config tx_pin = {
+        .pin = PIN_TXD,
+        .dir = OUTPUT,
+        .pull_up = PULL_UP_DISABLED,
+        .value = HIGH
+    };
+    pin_configure(tx_pin);
+
+    // Configure LED pin
+    struct pin_config led_pin = {
+        .pin = PIN_B5,
+        .dir = OUTPUT,
+        .pull_up = PULL_UP_DISABLED,
+        .value = LOW
+    };
+    pin_configure(led_pin);
+
+    // Configure button pin
+    struct pin_config button_pin = {
+        .pin = PIN_PCINT18,
+        .dir = INPUT,
+        .pull_up = PULL_UP_ENABLED,
+        .value = LOW
+    };
+    pin_configure(button_pin);
+    pin_enable_change_interrupt(button_pin.pin);
+
+    // Configure USART
+    struct usart_async_config config = {
+        .size = USART_8_BITS,
+        .stop_bits = USART_ONE_STOP_BIT,
+        .parity = USART_NO_PARITY,
+        .enable_tx = true,
+        .enable_rx = true
+    };
+    usart_async_configure(config, BAUD_RATE);
+    usart_enable_rx_interrupt();
+
+    scheduler_init();
+    scheduler_post_delayed(on_blink, 0, EVENT_PRIORITY_LOW, BLINK_PERIOD);
+    sei();
+
+    scheduler_run();
+    return 0;
+}
@@ -2,13 +2,15 @@
  * @file i2c_scanner.c
  * @author Iván Santiago (https://github.com/ivanstgo)
  * @date 01/09/2025 - 22:47
- * @brief This program probes each slave address and prints out scanning results
- * through USART0.
+ * @brief This program probes each non-reserved slave address at 400 kHz and
+ * prints out scanning results through USART0. Sending 'm' prints out the SRAM
+ * usage.
  */
 
 #include "drivers/io_pin.h"
 #include "drivers/usart_async.h"
 #include "drivers/twi.h"
+#include "system/stack_monitor.h"
 
 int main(void)
 {
@@ -40,52 +42,63 @@ int main(void)
     };
     usart_async_configure(usart_config, 9600);
     
-    // Configure 2-Wire serial interface
-    twi_configure(100000);
+    // Configure 2-Wire serial interface in fast mode
+    twi_configure(400000);
  
     while (true)
     {
         usart_async_put_string("Do you want to start a bus scan? [y/n]\n");
         
-        while (usart_receive() != 'y')
+        char option;
+        while ((option = usart_receive()) != 'y')
         {
+            if (option == 'm')
+            {
+                stack_monitor_report();
+            }
             usart_async_put_string("Do you want to start a bus scan? [y/n]\n");
         }
-        bool results[128];
-        for (uint16_t i = 0; i < 128; i++)
-        {
-            twi_start();
-            twi_transmit(TWI_SLA_READ(i));
-            results[i] = TW_STATUS == TW_MR_SLA_ACK;
-        }
-        twi_stop();
+        uint8_t found[TWI_SCAN_BITMAP_SIZE];
+        uint8_t count = twi_scan(found);
         char buffer[] = "   00 01 02 03 04 05 06 07 08 09 0A 0B 0C 0D 0E 0F\n";
         usart_async_put_string(buffer);
-        for (uint16_t i = 0; i < 8; i++)
+        for (uint8_t i = 0; i < 8; i++)
         {
             buffer[0] = '0' + i;
             buffer[1] = '0';
             buffer[2] = ' ';
-            uint16_t buffer_index = 3;
-            for (uint16_t j = 0; j < 16; j++)
+            uint8_t buffer_index = 3;
+            for (uint8_t j = 0; j < 16; j++)
             {
-                if (results[j | (i << 4)])
+                uint8_t sla = j | (i << 4);
+                if (sla < TWI_FIRST_ADDRESS || sla > TWI_LAST_ADDRESS)
+                {
+                    // Reserved addresses are not probed
+                    buffer[buffer_index] = ' ';
+                    buffer[buffer_index + 1] = ' ';
+                }
+                else if (twi_scan_found(found, sla))
                 {
                     buffer[buffer_index] = '0' + i;
                     buffer[buffer_index + 1] = j < 10 ? '0' + j : 'A' + j - 10;
-                    buffer[buffer_index + 2] = ' ';
                 }
                 else
                 {
                     buffer[buffer_index] = '-';
                     buffer[buffer_index + 1] = ' ';
-                    buffer[buffer_index + 2] = ' ';
                 }
+                buffer[buffer_index + 2] = ' ';
                 buffer_index += 3;
             }
             buffer[buffer_index] = '\n';
             usart_async_put_string(buffer);
         }
+        buffer[0] = '0' + count / 100;
+        buffer[1] = '0' + count / 10 % 10;
+        buffer[2] = '0' + count % 10;
+        buffer[3] = '\0';
+        usart_async_put_string(buffer);
+        usart_async_put_string(" devices found\n");
     }
     return 0;
 }
@@ -0,0 +1,246 @@
+/**
+ * @file logic_analyzer.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 22:00
+ * @brief This example program turns the board into a logic analyzer for the
+ * PD2-PD7 pins. Samples are sent through USART0 at 2 Mbaud as run-length
+ * encoded pairs (value, count), count goes from 1 to 255 and a pair with a
+ * count of 0 ends the capture. The end pair is followed by 'K', or by 'O' if
+ * samples were lost.
+ *
+ * Commands, multi-byte values are big-endian:
+ * - 'b' mask value trigger: captures CAPTURE_SIZE samples as fast as possible
+ *   once the trigger condition is met, then sends them.
+ * - 's' top mask value trigger: samples every top + 1 CPU cycles (Timer/Counter
+ *   1 in CTC mode) and streams the samples until any byte is received.
+ *
+ * trigger is 0 to start immediately, 1 to wait until (PIND & mask) == value
+ * and 2 to wait for the transition into that pattern.
+ *
+ * Maximum sample rates at 16 MHz:
+ * - Burst: groups of 8 samples taken every 3 cycles (5.33 MS/s) with 4 cycles
+ *   of loop overhead per group, 8 samples every 28 cycles (4.57 MS/s) on
+ *   average.
+ * - Streaming: about 250 kS/s (top = 63). The rate of input changes is limited
+ *   by the link, each change costs 2 bytes or 10 us at 2 Mbaud. Busier signals
+ *   fill the buffer and end the capture with 'O', as does a top too small for
+ *   the sampling loop to keep up with.
+ */
+#include "drivers/io_pin.h"
+#include "drivers/usart_async.h"
+
+#define BAUD_RATE 2000000
+#define CAPTURE_PIN PIND
+#define CAPTURE_MASK 0xFC
+#define CAPTURE_SIZE 1024
+
+/**
+ * @brief Streaming buffer size, it must be a power of two.
+ */
+#define STREAM_BUFFER_SIZE 256
+
+/**
+ * @brief Trigger condition.
+ */
+enum trigger
+{
+    TRIGGER_NONE,
+    TRIGGER_PATTERN,
+    TRIGGER_EDGE
+};
+
+static uint8_t samples[CAPTURE_SIZE];
+
+/**
+ * @brief Waits until the trigger condition is met.
+ */
+static void wait_for_trigger(enum trigger trigger, uint8_t mask, uint8_t value)
+{
+    value &= mask;
+    if (trigger == TRIGGER_EDGE)
+    {
+        while ((CAPTURE_PIN & mask) == value);
+    }
+    if (trigger != TRIGGER_NONE)
+    {
+        while ((CAPTURE_PIN & mask) != value);
+    }
+}
+
+/**
+ * @brief Fills the sample buffer in a tight unrolled loop. Assembly keeps the
+ * sampling period at exactly 3 cycles within each group of 8 samples.
+ */
+static void capture_burst(void)
+{
+    uint8_t *p = samples;
+    uint8_t *end = samples + CAPTURE_SIZE;
+    do
+    {
+        __asm__ volatile(
+            ".rept 8\n"
+            "in __tmp_reg__, %[port]\n"
+            "st %a[ptr]+, __tmp_reg__\n"
+            ".endr\n"
+            : [ptr] "+e"(p)
+            : [port] "I"(_SFR_IO_ADDR(CAPTURE_PIN))
+            : "memory");
+    } while (p != end);
+}
+
+/**
+ * @brief Sends a run-length encoded pair.
+ */
+static void send_run(uint8_t value, uint8_t count)
+{
+    usart_transmit(value);
+    usart_transmit(count);
+}
+
+/**
+ * @brief Sends the sample buffer compressed on the fly.
+ */
+static void send_burst(void)
+{
+    uint8_t value = samples[0] & CAPTURE_MASK;
+    uint8_t count = 0;
+    for (uint16_t i = 0; i < CAPTURE_SIZE; i++)
+    {
+        uint8_t sample = samples[i] & CAPTURE_MASK;
+        if (sample != value || count == UINT8_MAX)
+        {
+            send_run(value, count);
+            value = sample;
+            count = 0;
+        }
+        count++;
+    }
+    send_run(value, count);
+    send_run(value, 0);
+    usart_transmit('K');
+}
+
+/**
+ * @brief Samples on every Timer/Counter 1 compare match and streams the runs
+ * through a ring buffer drained between samples.
+ */
+static void capture_stream(uint16_t top)
+{
+    static uint8_t buffer[STREAM_BUFFER_SIZE];
+    uint8_t head = 0;
+    uint8_t tail = 0;
+    bool overrun = false;
+
+    OCR1A = top;
+    TCNT1 = 0;
+    TIFR1 = _BV(OCF1A);
+    TCCR1A = 0;
+    TCCR1B = _BV(WGM12) | _BV(CS10);
+
+    uint8_t value = CAPTURE_PIN & CAPTURE_MASK;
+    uint8_t count = 0;
+    while (bit_is_clear(UCSR0A, RXC0))
+    {
+        // A compare match before the wait means the last iteration took longer
+        // than the sampling period, the requested rate can not be kept
+        if (bit_is_set(TIFR1, OCF1A))
+        {
+            overrun = true;
+            break;
+        }
+        // Drain while waiting for the next sampling instant
+        while (bit_is_clear(TIFR1, OCF1A))
+        {
+            if (head != tail && bit_is_set(UCSR0A, UDRE0))
+            {
+                UDR0 = buffer[tail];
+                tail = (tail + 1) & (STREAM_BUFFER_SIZE - 1);
+            }
+        }
+        uint8_t sample = CAPTURE_PIN & CAPTURE_MASK;
+        TIFR1 = _BV(OCF1A);
+
+        if (sample != value || count == UINT8_MAX)
+        {
+            if (((tail - head - 1) & (STREAM_BUFFER_SIZE - 1)) < 2)
+            {
+                overrun = true;
+                break;
+            }
+            buffer[head] = value;
+            buffer[(head + 1) & (STREAM_BUFFER_SIZE - 1)] = count;
+            head = (head + 2) & (STREAM_BUFFER_SIZE - 1);
+            value = sample;
+            count = 0;
+        }
+        count++;
+    }
+    TCCR1B = 0;
+    if (bit_is_set(UCSR0A, RXC0)) usart_receive();
+
+    while (head != tail)
+    {
+        usart_transmit(buffer[tail]);
+        tail = (tail + 1) & (STREAM_BUFFER_SIZE - 1);
+    }
+    send_run(value, count);
+    send_run(value, 0);
+    usart_transmit(overrun ? 'O' : 'K');
+}
+
+int main(void)
+{
+    // Configure RX pin
+    struct pin_config rx_pin = {
+        .pin = PIN_RXD,
+        .dir = INPUT,
+        .pull_up = PULL_UP_DISABLED,
+        .value = LOW
+    };
+    pin_configure(rx_pin);
+
+    // Configure TX pin
+    struct pin_config tx_pin = {
+        .pin = PIN_TXD,
+        .dir = OUTPUT,
+        .pull_up = PULL_UP_DISABLED,
+        .value = HIGH
+    };
+    pin_configure(tx_pin);
+
+    // Configure USART
+    struct usart_async_config config = {
+        .size = USART_8_BITS,
+        .stop_bits = USART_ONE_STOP_BIT,
+        .parity = USART_NO_PARITY,
+        .enable_tx = true,
+        .enable_rx = true,
+        .double_speed = true
+    };
+    usart_async_configure(config, BAUD_RATE);
+
+    while (1)
+    {
+        uint8_t command = usart_receive();
+        if (command == 'b')
+        {
+            uint8_t mask = usart_receive();
+            uint8_t value = usart_receive();
+            enum trigger trigger = usart_receive();
+            wait_for_trigger(trigger, mask, value);
+            capture_burst();
+            send_burst();
+        }
+        else if (command == 's')
+        {
+            uint16_t top = (uint16_t)usart_receive() << 8;
+            top |= usart_receive();
+            uint8_t mask = usart_receive();
+            uint8_t value = usart_receive();
+            enum trigger trigger = usart_receive();
+            wait_for_trigger(trigger, mask, value);
+            capture_stream(top);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file trace_log.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 17:20
+ * @brief This example program traces a counter every 100 ms and the state of a
+ * button connected to PD2 whenever it changes. Records are sent through USART0
+ * at 115200 baud while the program waits, decode them on the host with
+ * tools/trace/trace_decode.py trace_log.elf <serial port>.
+ */
+#include <util/delay.h>
+#include "drivers/io_pin.h"
+#include "drivers/usart_async.h"
+#include "system/trace.h"
+
+#define BAUD_RATE 115200
+
+int main(void)
+{
+    // Configure TX pin
+    struct pin_config tx_pin = {
+        .pin = PIN_TXD,
+        .dir = OUTPUT,
+        .pull_up = PULL_UP_DISABLED,
+        .value = HIGH
+    };
+    pin_configure(tx_pin);
+
+    // Configure button pin
+    struct pin_config button_pin = {
+        .pin = PIN_D2,
+        .dir = INPUT,
+        .pull_up = PULL_UP_ENABLED,
+        .value = LOW
+    };
+    pin_configure(button_pin);
+
+    // Configure USART
+    struct usart_async_config config = {
+        .size = USART_8_BITS,
+        .stop_bits = USART_ONE_STOP_BIT,
+        .parity = USART_NO_PARITY,
+        .enable_tx = true,
+        .enable_rx = false
+    };
+    usart_async_configure(config, BAUD_RATE);
+
+    TRACE0("trace_log started");
+    uint16_t count = 0;
+    uint8_t button = pin_read(button_pin.pin);
+    while (1)
+    {
+        TRACE2("count %u, %u records dropped", count, trace_dropped());
+        count++;
+
+        // Poll the button and drain the buffer for 100 ms
+        for (uint8_t i = 0; i < 100; i++)
+        {
+            uint8_t state = pin_read(button_pin.pin);
+            if (state != button)
+            {
+                button = state;
+                TRACE1("button %c", (char)(state ? 'u' : 'd'));
+            }
+            trace_flush();
+            _delay_ms(1);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file usart_benchmark.cpp
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 19:00
+ * @brief This example program measures, in CPU cycles with Timer/Counter 1,
+ * the C and the C++ USART0 drivers configuring 8N1@115200 and transmitting a
+ * 16-byte block, then prints out the results through USART0 e.g.
+ * "c configure=... write=...". The write is timed from an idle transmitter, so
+ * both paths wait for the same line time and the difference is driver
+ * overhead.
+ */
+#include <stdlib.h>
+#include "drivers/io_pin.h"
+#include "drivers/usart_async.h"
+#include "drivers/usart_async.hpp"
+
+#define BAUD_RATE 115200
+#define BLOCK_SIZE 16
+
+using Serial = sdk::Usart<BAUD_RATE, sdk::UsartFrame8N1>;
+
+static uint8_t block[BLOCK_SIZE];
+
+/**
+ * @brief Starts Timer/Counter 1 from zero at the CPU clock.
+ */
+static inline void timer_start(void)
+{
+    TCCR1A = 0;
+    TCCR1B = 0;
+    TCNT1 = 0;
+    TCCR1B = _BV(CS10);
+}
+
+/**
+ * @brief Stops Timer/Counter 1.
+ * @return Elapsed cycles.
+ */
+static inline uint16_t timer_stop(void)
+{
+    TCCR1B = 0;
+    return TCNT1;
+}
+
+/**
+ * @brief Waits until the transmitter has sent everything.
+ */
+static void wait_idle(void)
+{
+    loop_until_bit_is_set(UCSR0A, UDRE0);
+    UCSR0A = (UCSR0A & _BV(U2X0)) | _BV(TXC0);
+    loop_until_bit_is_set(UCSR0A, TXC0);
+}
+
+static void put_result(const char *label, uint16_t configure, uint16_t write)
+{
+    char digits[6];
+    usart_async_put_string(label);
+    usart_async_put_string(" configure=");
+    usart_async_put_string(utoa(configure, digits, 10));
+    usart_async_put_string(" write=");
+    usart_async_put_string(utoa(write, digits, 10));
+    usart_async_put_string("\n");
+}
+
+int main(void)
+{
+    // Configure TX pin
+    struct pin_config tx_pin = {
+        .pin = PIN_TXD,
+        .dir = OUTPUT,
+        .pull_up = PULL_UP_DISABLED,
+        .value = HIGH
+    };
+    pin_configure(tx_pin);
+
+    for (uint8_t i = 0; i < BLOCK_SIZE; i++) block[i] = 'a' + i;
+
+    // Timer overhead, subtracted from every measurement
+    timer_start();
+    uint16_t overhead = timer_stop();
+
+    // C driver, double speed mode gives the same UBRR0 as the C++ driver
+    struct usart_async_config config = {
+        .size = USART_8_BITS,
+        .stop_bits = USART_ONE_STOP_BIT,
+        .parity = USART_NO_PARITY,
+        .enable_tx = true,
+        .enable_rx = true,
+        .multi_processor = false,
+        .double_speed = true
+    };
+    timer_start();
+    usart_async_configure(config, BAUD_RATE);
+    uint16_t c_configure = timer_stop() - overhead;
+    wait_idle();
+    timer_start();
+    usart_async_write(block, BLOCK_SIZE);
+    uint16_t c_write = timer_stop() - overhead;
+    wait_idle();
+
+    // C++ driver
+    timer_start();
+    Serial::configure();
+    uint16_t cpp_configure = timer_stop() - overhead;
+    wait_idle();
+    timer_start();
+    Serial::write(block, BLOCK_SIZE);
+    uint16_t cpp_write = timer_stop() - overhead;
+    wait_idle();
+
+    usart_async_put_string("\n");
+    put_result("c", c_configure, c_write);
+    put_result("cpp", cpp_configure, cpp_write);
+
+    while (1);
+    return 0;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file usart_echo.cpp
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 19:00
+ * @brief C++ version of the usart_echo example built on the header-only
+ * drivers. It configures USART0 8N1@9600 and transmits back the content of a
+ * buffer after filling it with received data, stopping at the first receive
+ * error. It behaves like usart_echo so both images can be compared with the
+ * usart_echo_size target.
+ */
+#include "drivers/io_pin.h"
+#include "drivers/usart_async.hpp"
+
+#define BAUD_RATE 9600
+#define BUFFER_SIZE 4
+
+using Serial = sdk::Usart<BAUD_RATE, sdk::UsartFrame8N1>;
+
+int main(void)
+{
+    // Configure RX pin
+    struct pin_config rx_pin = {
+        .pin = PIN_RXD,
+        .dir = INPUT,
+        .pull_up = PULL_UP_DISABLED,
+        .value = LOW
+    };
+    pin_configure(rx_pin);
+
+    // Configure TX pin
+    struct pin_config tx_pin = {
+        .pin = PIN_TXD,
+        .dir = OUTPUT,
+        .pull_up = PULL_UP_DISABLED,
+        .value = HIGH
+    };
+    pin_configure(tx_pin);
+
+    Serial::configure();
+
+    uint8_t buffer[BUFFER_SIZE];
+    uint16_t received = 0;
+    Serial::put_string("Using USART0 in asynchronous mode.");
+    while(1)
+    {
+        received = Serial::read(buffer, BUFFER_SIZE);
+        Serial::write(buffer, received);
+    }
+    return 0;
+}
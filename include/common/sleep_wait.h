@@ -0,0 +1,78 @@
+/**
+ * @file sleep_wait.h
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 13:10
+ * @brief This header file provides the macro used by blocking driver calls to
+ * wait for a peripheral flag. When SDK_SLEEP_WAIT is defined the CPU enters
+ * idle sleep mode until the peripheral interrupt fires instead of polling.
+ *
+ * The wake-up interrupt handlers live in the sleep_wait library, one object per
+ * vector. Each wait references the anchor symbol of its handler, so the linker
+ * always pulls the handler in, also for header-only drivers, and a missing
+ * sleep_wait library is reported as an undefined reference.
+ */
+
+#ifndef __SLEEP_WAIT_H
+#define __SLEEP_WAIT_H
+
+#include <avr/io.h>
+
+#ifdef SDK_SLEEP_WAIT
+
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+/**
+ * @brief Defines the anchor symbol of a wake-up handler, it must be placed in
+ * the same source file as the handler.
+ */
+#define SLEEP_WAIT_ANCHOR(WAKE)                                               \
+    __asm__(".global sleep_wait_" #WAKE "_anchor\n"                          \
+            ".set sleep_wait_" #WAKE "_anchor, 0")
+
+/**
+ * @brief References the anchor symbol of a wake-up handler from a section that
+ * is not loaded, so it costs no flash.
+ */
+#define SLEEP_WAIT_USE(WAKE)                                                  \
+    __asm__ __volatile__(".pushsection .sleep_wait,\"\",@progbits\n"         \
+                         ".long sleep_wait_" #WAKE "_anchor\n"               \
+                         ".popsection")
+
+/**
+ * @brief Waits until a bit is set. ARM enables the interrupt that signals the
+ * bit, the wake-up handler WAKE disables it again before returning.
+ * @note Global interrupts are enabled while sleeping and restored afterwards.
+ */
+#define WAIT_UNTIL_BIT_IS_SET(REG, BIT, ARM, WAKE)                            \
+    do                                                                        \
+    {                                                                         \
+        SLEEP_WAIT_USE(WAKE);                                                 \
+        while (bit_is_clear(REG, BIT))                                        \
+        {                                                                     \
+            uint8_t sleep_wait_sreg = SREG;                                   \
+            cli();                                                            \
+            if (bit_is_clear(REG, BIT))                                       \
+            {                                                                 \
+                ARM;                                                          \
+                set_sleep_mode(SLEEP_MODE_IDLE);                              \
+                sleep_enable();                                               \
+                sei();                                                        \
+                sleep_cpu();                                                  \
+                sleep_disable();                                              \
+            }                                                                 \
+            SREG = sleep_wait_sreg;                                           \
+        }                                                                     \
+    } while (0)
+
+#else
+
+/**
+ * @brief Waits until a bit is set by polling it.
+ */
+#define WAIT_UNTIL_BIT_IS_SET(REG, BIT, ARM, WAKE)                            \
+    loop_until_bit_is_set(REG, BIT)
+
+#endif /* SDK_SLEEP_WAIT */
+
+#endif /* !__SLEEP_WAIT_H */
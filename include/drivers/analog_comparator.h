@@ -0,0 +1,135 @@
+/**
+ * @file analog_comparator.h
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 20:40
+ * @brief ATmega328P analog comparator driver.
+ */
+
+#ifndef __ANALOG_COMPARATOR_H
+#define __ANALOG_COMPARATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <avr/io.h>
+
+/**
+ * @brief Bit that marks a negative input as one of the ADC multiplexer
+ * channels.
+ */
+#define AC_ADC_MUX 0x08
+
+/**
+ * @brief Positive input.
+ */
+enum ac_positive_input
+{
+    /** @brief PIN_AIN0 */
+    AC_POSITIVE_AIN0,
+    /** @brief Internal 1.1 V bandgap reference */
+    AC_POSITIVE_BANDGAP = _BV(ACBG)
+};
+
+/**
+ * @brief Negative input. ADC channels are selected through the ADC
+ * multiplexer, which requires the ADC to be disabled.
+ */
+enum ac_negative_input
+{
+    /** @brief PIN_AIN1 */
+    AC_NEGATIVE_AIN1,
+    AC_NEGATIVE_ADC0 = AC_ADC_MUX,
+    AC_NEGATIVE_ADC1,
+    AC_NEGATIVE_ADC2,
+    AC_NEGATIVE_ADC3,
+    AC_NEGATIVE_ADC4,
+    AC_NEGATIVE_ADC5,
+    AC_NEGATIVE_ADC6,
+    AC_NEGATIVE_ADC7
+};
+
+/**
+ * @brief Comparator output event that triggers ANALOG_COMP_vect.
+ */
+enum ac_interrupt_mode
+{
+    AC_INT_TOGGLE,
+    AC_INT_FALLING_EDGE = _BV(ACIS1),
+    AC_INT_RISING_EDGE = _BV(ACIS1) | _BV(ACIS0)
+};
+
+/**
+ * @brief Comparator output edge that triggers a Timer/Counter 1 input capture.
+ */
+enum ac_capture_edge
+{
+    AC_CAPTURE_FALLING_EDGE,
+    AC_CAPTURE_RISING_EDGE = _BV(ICES1)
+};
+
+/**
+ * @brief Analog comparator configuration struct.
+ */
+struct ac_config
+{
+    enum ac_positive_input positive;
+    enum ac_negative_input negative;
+    enum ac_interrupt_mode interrupt_mode;
+    bool enable_interrupt;
+    /** @brief Routes the output to the Timer/Counter 1 input capture unit */
+    bool enable_input_capture;
+    enum ac_capture_edge capture_edge;
+    /** @brief Enables the input capture noise canceler (4 timer clocks) */
+    bool capture_noise_canceler;
+};
+
+/**
+ * @brief Configures and enables the analog comparator. Digital input buffers
+ * of PIN_AIN0/PIN_AIN1 and of the ADC0-ADC5 negative input are disabled when
+ * they are used as inputs. DIDR0 bits are never cleared, they may belong to
+ * ADC channels.
+ * @param config Comparator configuration.
+ * @note Timer/Counter 1 must be running for input capture to timestamp the
+ * output edges in ICR1, TIMER1_CAPT_vect is triggered if ICIE1 is set. The
+ * bandgap reference needs some time to settle after being selected.
+ */
+void analog_comparator_configure(struct ac_config config);
+
+/**
+ * @brief Disables the analog comparator to reduce power consumption.
+ */
+void analog_comparator_disable(void);
+
+/**
+ * @brief Reads the comparator output.
+ * @return 1 if the positive input is higher than the negative input.
+ */
+static inline uint8_t analog_comparator_read(void)
+{
+    return (ACSR >> ACO) & 0x01;
+}
+
+/**
+ * @brief Enables ANALOG_COMP_vect.
+ */
+static inline void analog_comparator_enable_interrupt(void)
+{
+    ACSR = (ACSR & ~_BV(ACI)) | _BV(ACIE);
+}
+
+/**
+ * @brief Disables ANALOG_COMP_vect.
+ */
+static inline void analog_comparator_disable_interrupt(void)
+{
+    ACSR &= ~(_BV(ACIE) | _BV(ACI));
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* !__ANALOG_COMPARATOR_H */
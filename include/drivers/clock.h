@@ -0,0 +1,83 @@
+/**
+ * @file clock.h
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 22:40
+ * @brief ATmega328P system clock prescaler driver. Drivers that derive their
+ * timing from the CPU clock register a listener to be retimed whenever the
+ * prescaler changes.
+ */
+
+#ifndef __CLOCK_H
+#define __CLOCK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Maximum number of clock change listeners.
+ */
+#ifndef CLOCK_MAX_LISTENERS
+#define CLOCK_MAX_LISTENERS 4
+#endif /* !CLOCK_MAX_LISTENERS */
+
+/**
+ * @brief System clock division factor, F_CPU is divided by 2^prescaler.
+ */
+enum clock_prescaler
+{
+    CLOCK_DIV_1,
+    CLOCK_DIV_2,
+    CLOCK_DIV_4,
+    CLOCK_DIV_8,
+    CLOCK_DIV_16,
+    CLOCK_DIV_32,
+    CLOCK_DIV_64,
+    CLOCK_DIV_128,
+    CLOCK_DIV_256
+};
+
+/**
+ * @brief Clock change listener, it is called with the new prescaler and
+ * returns false if its peripheral cannot keep its timing within tolerance.
+ */
+typedef bool (*clock_listener_t)(enum clock_prescaler prescaler);
+
+/**
+ * @brief Registers a function to be called after the prescaler changes e.g.
+ * usart_async_clock_changed, twi_clock_changed or scheduler_clock_changed.
+ * @param listener Listener.
+ * @return false if there is no room for another listener.
+ */
+bool clock_register_listener(clock_listener_t listener);
+
+/**
+ * @brief Changes the system clock prescaler and notifies the listeners.
+ * @param prescaler New prescaler.
+ * @return false if a listener reported that its timing is out of tolerance,
+ * the prescaler is changed and every listener is notified anyway.
+ * @note F_CPU must be the undivided clock frequency. Busy-wait delays from
+ * util/delay.h are not retimed.
+ */
+bool clock_set_prescaler(enum clock_prescaler prescaler);
+
+/**
+ * @brief Gets the current system clock prescaler.
+ * @return Current prescaler.
+ */
+enum clock_prescaler clock_get_prescaler(void);
+
+/**
+ * @brief Gets the current CPU frequency.
+ * @return Frequency in Hz.
+ */
+uint32_t clock_get_frequency(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* !__CLOCK_H */
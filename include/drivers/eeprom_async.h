@@ -0,0 +1,114 @@
+/**
+ * @file eeprom_async.h
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 15:05
+ * @brief ATmega328P EEPROM driver. Writes are queued and committed in the
+ * background from the EEPROM ready interrupt.
+ */
+
+#ifndef __EEPROM_ASYNC_H
+#define __EEPROM_ASYNC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Number of bytes that can be waiting to be written, it must be a power
+ * of two.
+ */
+#ifndef EEPROM_ASYNC_QUEUE_SIZE
+#define EEPROM_ASYNC_QUEUE_SIZE 16
+#endif /* !EEPROM_ASYNC_QUEUE_SIZE */
+
+/**
+ * @brief Number of entries of the direct-mapped read cache, it must be a power
+ * of two.
+ */
+#ifndef EEPROM_ASYNC_CACHE_SIZE
+#define EEPROM_ASYNC_CACHE_SIZE 8
+#endif /* !EEPROM_ASYNC_CACHE_SIZE */
+
+/**
+ * @brief Number of EEPROM bytes used by a wear-leveling ring.
+ */
+#define EEPROM_RING_FOOTPRINT(SIZE, LENGTH) ((uint16_t)(LENGTH) * ((SIZE) + 1u))
+
+/**
+ * @brief Wear-leveling ring. It spreads the writes of a frequently updated
+ * value over LENGTH slots, followed by one status byte per slot.
+ */
+struct eeprom_ring
+{
+    uint16_t address;
+    uint8_t size;
+    uint8_t length;
+    uint8_t index;
+};
+
+/**
+ * @brief Queues data to be written to the EEPROM. Bytes that already hold the
+ * requested value are not written.
+ * @param address EEPROM address.
+ * @param src Data source.
+ * @param length Number of bytes to write.
+ * @return Number of bytes queued, it is less than length if the queue is full.
+ * @note Global interrupts must be enabled for the data to be committed.
+ */
+uint16_t eeprom_async_write(uint16_t address, const uint8_t *src,
+                            uint16_t length);
+
+/**
+ * @brief Reads data from the EEPROM, including queued bytes that have not been
+ * committed yet.
+ * @param address EEPROM address.
+ * @param dst Data destination.
+ * @param length Number of bytes to read.
+ * @note It only waits for an ongoing write when a byte misses the cache.
+ */
+void eeprom_async_read(uint16_t address, uint8_t *dst, uint16_t length);
+
+/**
+ * @brief Checks if there are bytes that have not been committed yet.
+ * @return true while a write is pending or in progress.
+ */
+bool eeprom_async_busy(void);
+
+/**
+ * @brief Waits until every queued byte has been committed.
+ */
+void eeprom_async_flush(void);
+
+/**
+ * @brief Initializes a wear-leveling ring and finds its most recent slot.
+ * @param ring Ring.
+ * @param address EEPROM address of the first slot.
+ * @param size Size of the stored value in bytes.
+ * @param length Number of slots.
+ */
+void eeprom_ring_init(struct eeprom_ring *ring, uint16_t address, uint8_t size,
+                      uint8_t length);
+
+/**
+ * @brief Reads the most recent value stored in a ring.
+ * @param ring Ring.
+ * @param dst Data destination, it must hold ring->size bytes.
+ */
+void eeprom_ring_read(const struct eeprom_ring *ring, void *dst);
+
+/**
+ * @brief Queues a new value to be written to the next slot of a ring.
+ * @param ring Ring.
+ * @param src Data source, it must hold ring->size bytes.
+ * @return false if the queue could not hold the value and its status byte.
+ */
+bool eeprom_ring_write(struct eeprom_ring *ring, const void *src);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* !__EEPROM_ASYNC_H */
@@ -0,0 +1,73 @@
+/**
+ * @file power.h
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 13:40
+ * @brief ATmega328P power management driver.
+ */
+
+#ifndef __POWER_H
+#define __POWER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <avr/io.h>
+
+/**
+ * @brief Peripherals whose clock can be stopped through the power reduction
+ * register. Values can be combined with a bitwise OR.
+ */
+enum power_peripheral
+{
+    POWER_ADC = _BV(PRADC),
+    POWER_USART0 = _BV(PRUSART0),
+    POWER_SPI = _BV(PRSPI),
+    POWER_TIMER1 = _BV(PRTIM1),
+    POWER_TIMER0 = _BV(PRTIM0),
+    POWER_TIMER2 = _BV(PRTIM2),
+    POWER_TWI = _BV(PRTWI),
+    POWER_ALL = _BV(PRADC) | _BV(PRUSART0) | _BV(PRSPI) | _BV(PRTIM1) |
+                _BV(PRTIM0) | _BV(PRTIM2) | _BV(PRTWI)
+};
+
+/**
+ * @brief Stops the clock of the given peripherals.
+ * @param peripherals Combination of power_peripheral values.
+ * @note The ADC must be disabled before its clock is stopped. A peripheral
+ * keeps its configuration but it can not be accessed while it is disabled.
+ */
+static inline void power_disable_peripherals(uint8_t peripherals)
+{
+    PRR |= peripherals;
+}
+
+/**
+ * @brief Restarts the clock of the given peripherals.
+ * @param peripherals Combination of power_peripheral values.
+ */
+static inline void power_enable_peripherals(uint8_t peripherals)
+{
+    PRR &= ~peripherals;
+}
+
+/**
+ * @brief Enters idle sleep mode until any interrupt fires.
+ */
+void power_idle(void);
+
+/**
+ * @brief Enters power-down sleep mode with the brown-out detector disabled.
+ * Only the following sources wake the CPU up: INT0/INT1 configured as
+ * INT_LOW_LEVEL, pin change interrupts, TWI address match and the watchdog.
+ * @note The wake-up source must be enabled and have an interrupt service
+ * routine, global interrupts are enabled by this function.
+ */
+void power_down(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* !__POWER_H */
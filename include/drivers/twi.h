@@ -8,9 +8,16 @@
 #ifndef __TWI_H
 #define __TWI_H
 
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
 #include <stdint.h>
+#include <stdbool.h>
 #include <avr/io.h>
 #include <util/twi.h>
+#include "common/sleep_wait.h"
+#include "drivers/clock.h"
 
 /**
  * @brief Macro to format a slave address for reading.
@@ -22,6 +29,33 @@
  */
 #define TWI_SLA_READ(SLA) (((SLA) << 1u) | TW_READ)
 
+/**
+ * @brief First and last slave addresses that are not reserved by the I2C
+ * specification.
+ */
+#define TWI_FIRST_ADDRESS 0x08
+#define TWI_LAST_ADDRESS 0x77
+
+/**
+ * @brief Size of the bitmap filled by twi_scan, one bit per 7-bit address.
+ */
+#define TWI_SCAN_BITMAP_SIZE 16
+
+/**
+ * @brief Maximum time in microseconds twi_wait_timeout waits for a bus
+ * operation.
+ */
+#ifndef TWI_TIMEOUT_US
+#define TWI_TIMEOUT_US 1000ul
+#endif /* !TWI_TIMEOUT_US */
+
+/**
+ * @brief Maximum time in microseconds a probe waits for each bus operation.
+ */
+#ifndef TWI_PROBE_TIMEOUT_US
+#define TWI_PROBE_TIMEOUT_US 1000ul
+#endif /* !TWI_PROBE_TIMEOUT_US */
+
 /**
  * @brief Prescaler value.
  */
@@ -42,15 +76,23 @@ enum twi_control_byte
     TWI_SEND_STOP_CONDITION = _BV(TWEN) | _BV(TWSTO) | _BV(TWINT),
     TWI_TRANSMIT_BYTE = _BV(TWEN) | _BV(TWEA) | _BV(TWINT),
     TWI_RECEIVE_BYTE = TWI_TRANSMIT_BYTE,
+    TWI_RECEIVE_LAST_BYTE = _BV(TWEN) | _BV(TWINT),
 };
 
+/**
+ * @brief Waits until the current bus operation has finished.
+ */
+#define TWI_WAIT()                                                            \
+    WAIT_UNTIL_BIT_IS_SET(TWCR, TWINT,                                        \
+                          TWCR = (TWCR & ~_BV(TWINT)) | _BV(TWIE), twi)
+
 /**
  * @brief Generates a start condition.
  */
 static inline void twi_start(void)
 {
     TWCR = TWI_SEND_START_CONDITION;
-    loop_until_bit_is_set(TWCR, TWINT);
+    TWI_WAIT();
 }
 
 /**
@@ -69,7 +111,7 @@ static inline void twi_transmit(uint8_t data)
 {
     TWDR = data;
     TWCR = TWI_TRANSMIT_BYTE;
-    loop_until_bit_is_set(TWCR, TWINT);
+    TWI_WAIT();
 }
 
 /**
@@ -79,16 +121,74 @@ static inline void twi_transmit(uint8_t data)
 static inline uint8_t twi_receive(void)
 {
     TWCR = TWI_RECEIVE_BYTE;
-    loop_until_bit_is_set(TWCR, TWINT);
+    TWI_WAIT();
+    return TWDR;
+}
+
+/**
+ * @brief Receives the last byte of a read, it is answered with a NACK so the
+ * slave releases the bus.
+ * @return Received byte.
+ */
+static inline uint8_t twi_receive_last(void)
+{
+    TWCR = TWI_RECEIVE_LAST_BYTE;
+    TWI_WAIT();
     return TWDR;
 }
 
 /**
  * @brief Configures the 2-wire serial interface.
  * @param bit_rate Bit rate in Hz e.g. 100000.
+ * @note The bit rate is set for the current system clock prescaler.
  */
 void twi_configure(uint32_t bit_rate);
 
+/**
+ * @brief Retimes the bit rate after a system clock change, register it with
+ * clock_register_listener.
+ * @param prescaler New system clock prescaler.
+ * @return false if the divided clock is too slow for the bit rate, the
+ * fastest possible bit rate is used then.
+ */
+bool twi_clock_changed(enum clock_prescaler prescaler);
+
+/**
+ * @brief Waits until the current bus operation has finished, giving up after
+ * TWI_TIMEOUT_US. Unlike TWI_WAIT it never sleeps, it polls TWINT.
+ * @return false if the timeout expired, the interface is then disabled to
+ * release the bus lines and the next start condition enables it again.
+ */
+bool twi_wait_timeout(void);
+
+/**
+ * @brief Checks if a slave acknowledges its address. It sends SLA+W followed
+ * by a stop condition, so no data is transferred. Every bus operation is
+ * bounded by TWI_PROBE_TIMEOUT_US, the interface is reset when it expires.
+ * @param sla Slave address.
+ * @return true if the slave acknowledged.
+ */
+bool twi_probe(uint8_t sla);
+
+/**
+ * @brief Probes every non-reserved slave address.
+ * @param bitmap Result, bit (sla & 7) of bitmap[sla >> 3] is set when sla
+ * acknowledged.
+ * @return Number of slaves found.
+ */
+uint8_t twi_scan(uint8_t bitmap[TWI_SCAN_BITMAP_SIZE]);
+
+/**
+ * @brief Checks a twi_scan result.
+ * @param bitmap Bitmap filled by twi_scan.
+ * @param sla Slave address.
+ * @return true if the slave was found.
+ */
+static inline bool twi_scan_found(const uint8_t *bitmap, uint8_t sla)
+{
+    return (bitmap[sla >> 3] >> (sla & 0x07)) & 0x01;
+}
+
 /**
  * @brief Writes data to a slave.
  * @param sla Slave address.
@@ -105,4 +205,8 @@ uint16_t twi_write(uint8_t sla, uint8_t *src, uint16_t length);
  */
 uint16_t twi_read(uint8_t sla, uint8_t *dst, uint16_t length);
 
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
 #endif /* !__TWI_H */
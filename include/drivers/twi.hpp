@@ -0,0 +1,121 @@
+/**
+ * @file twi.hpp
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 19:00
+ * @brief Header-only C++ driver for the ATmega328P 2-wire serial interface in
+ * master mode. The bit rate registers are computed at compile time.
+ */
+
+#ifndef __TWI_HPP
+#define __TWI_HPP
+
+#include "drivers/twi.h"
+
+#ifndef F_CPU
+#define F_CPU 16000000ul
+#warning "Using F_CPU=16000000ul for bit rate calculation as it has not been defined."
+#endif /* !F_CPU */
+
+namespace sdk
+{
+
+/**
+ * @brief 2-wire serial interface master.
+ * @tparam BitRate SCL frequency in Hz e.g. 100000.
+ */
+template <uint32_t BitRate>
+class TwiMaster
+{
+    static_assert(BitRate > 0 && F_CPU / BitRate >= 16,
+                  "Bit rate too high for F_CPU.");
+
+    // SCL = F_CPU / (16 + 2 * TWBR * prescaler)
+    static constexpr uint32_t twbr_for(uint32_t prescaler)
+    {
+        return (F_CPU / BitRate - 16) / (2 * prescaler);
+    }
+
+    static constexpr uint8_t prescaler_bits =
+        twbr_for(1) <= 255    ? TWI_PRESCALER_VALUE_1
+        : twbr_for(4) <= 255  ? TWI_PRESCALER_VALUE_4
+        : twbr_for(16) <= 255 ? TWI_PRESCALER_VALUE_16
+                              : TWI_PRESCALER_VALUE_64;
+
+    static_assert(twbr_for(64) <= 255, "Bit rate too low for F_CPU.");
+
+public:
+    /** @brief TWBR value */
+    static constexpr uint8_t twbr =
+        twbr_for(prescaler_bits == TWI_PRESCALER_VALUE_1    ? 1
+                 : prescaler_bits == TWI_PRESCALER_VALUE_4  ? 4
+                 : prescaler_bits == TWI_PRESCALER_VALUE_16 ? 16
+                                                            : 64);
+
+    /**
+     * @brief Configures the 2-wire serial interface.
+     */
+    static void configure()
+    {
+        TWSR = prescaler_bits;
+        TWBR = twbr;
+        TWCR = 0;
+    }
+
+    /**
+     * @brief Writes data to a slave.
+     * @param sla Slave address.
+     * @param src Data source.
+     * @param length Number of bytes to transmit.
+     * @return Number of bytes acknowledged by the slave.
+     */
+    static uint16_t write(uint8_t sla, const uint8_t *src, uint16_t length)
+    {
+        twi_start();
+        twi_transmit(TWI_SLA_WRITE(sla));
+        if (TW_STATUS != TW_MT_SLA_ACK)
+        {
+            twi_stop();
+            return 0;
+        }
+        uint16_t i = 0;
+        while (i < length)
+        {
+            twi_transmit(src[i]);
+            if (TW_STATUS != TW_MT_DATA_ACK) break;
+            i++;
+        }
+        twi_stop();
+        return i;
+    }
+
+    /**
+     * @brief Reads data from a slave.
+     * @param sla Slave address.
+     * @param dst Data destination.
+     * @param length Number of bytes to receive.
+     * @return Number of bytes received.
+     */
+    static uint16_t read(uint8_t sla, uint8_t *dst, uint16_t length)
+    {
+        twi_start();
+        twi_transmit(TWI_SLA_READ(sla));
+        if (TW_STATUS != TW_MR_SLA_ACK)
+        {
+            twi_stop();
+            return 0;
+        }
+        uint16_t i = 0;
+        while (i < length)
+        {
+            dst[i] = twi_receive();
+            if (TW_STATUS != TW_MR_DATA_ACK) break;
+            i++;
+        }
+        twi_stop();
+        return i;
+    }
+};
+
+} // namespace sdk
+
+#endif /* !__TWI_HPP */
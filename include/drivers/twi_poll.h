@@ -0,0 +1,131 @@
+/**
+ * @file twi_poll.h
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 23:20
+ * @brief Periodic register polling engine built on the 2-wire serial interface
+ * driver. Jobs are declared in a table, the due ones are read back to back in
+ * a single bus session and their results are double-buffered.
+ */
+
+#ifndef __TWI_POLL_H
+#define __TWI_POLL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Initializer for a polling job.
+ * @param SLA Slave address.
+ * @param REG First register to read.
+ * @param BUFFERS Destination, a uint8_t[2][length] array.
+ * @param PERIOD Polling period in ticks.
+ */
+#define TWI_POLL_JOB(SLA, REG, BUFFERS, PERIOD)                               \
+    {                                                                         \
+        .sla = (SLA), .reg = (REG), .length = sizeof(BUFFERS[0]),             \
+        .period = (PERIOD), .buffers = &(BUFFERS)[0][0]                       \
+    }
+
+/**
+ * @brief Polling job. The first five fields are set by TWI_POLL_JOB, the rest
+ * are managed by the engine. Jobs with a length of zero always fail.
+ */
+struct twi_poll_job
+{
+    uint8_t sla;
+    uint8_t reg;
+    uint8_t length;
+    uint16_t period;
+    uint8_t *buffers;
+    /** @brief Buffer that holds the last complete read */
+    volatile uint8_t front;
+    /** @brief Tick of the last complete read */
+    uint16_t updated;
+    uint16_t due;
+    /** @brief Failed reads, saturates at 255 */
+    uint8_t errors;
+    bool valid;
+};
+
+/**
+ * @brief Polling engine statistics.
+ */
+struct twi_poll_stats
+{
+    /** @brief Bus sessions started */
+    uint16_t sessions;
+    /** @brief Failed job reads */
+    uint16_t errors;
+    /** @brief Bit periods spent on the bus, including start and stop conditions */
+    uint32_t bus_bits;
+};
+
+/**
+ * @brief Initializes the jobs, they all become due at now.
+ * @param jobs Job table.
+ * @param count Number of jobs.
+ * @param now Current tick.
+ * @note The bus must have been configured with twi_configure.
+ */
+void twi_poll_init(struct twi_poll_job *jobs, uint8_t count, uint16_t now);
+
+/**
+ * @brief Reads every due job in one bus session, jobs are chained with
+ * repeated start conditions and the bus is released once at the end. Every
+ * bus operation is bounded by TWI_TIMEOUT_US, a timeout ends the session.
+ * @param jobs Job table.
+ * @param count Number of jobs.
+ * @param now Current tick, e.g. scheduler_ticks().
+ * @return Number of jobs read successfully.
+ */
+uint8_t twi_poll_run(struct twi_poll_job *jobs, uint8_t count, uint16_t now);
+
+/**
+ * @brief Gets the last complete read of a job. The data stays consistent
+ * until the job is read again, copy it if it is needed for longer.
+ * @param job Job.
+ * @return Pointer to job->length bytes.
+ */
+static inline const uint8_t *twi_poll_snapshot(const struct twi_poll_job *job)
+{
+    return job->buffers + (job->front ? job->length : 0);
+}
+
+/**
+ * @brief Gets the number of ticks since the last complete read of a job.
+ * @param job Job.
+ * @param now Current tick.
+ * @return Age in ticks, UINT16_MAX if the job has never been read.
+ */
+static inline uint16_t twi_poll_age(const struct twi_poll_job *job,
+                                    uint16_t now)
+{
+    return job->valid ? (uint16_t)(now - job->updated) : UINT16_MAX;
+}
+
+/**
+ * @brief Gets a copy of the statistics and clears them.
+ * @param stats Statistics destination.
+ */
+void twi_poll_take_stats(struct twi_poll_stats *stats);
+
+/**
+ * @brief Computes the bus utilization.
+ * @param stats Statistics taken over the measurement interval.
+ * @param bit_rate Bus bit rate in Hz.
+ * @param elapsed_ms Measurement interval in milliseconds.
+ * @return Utilization in tenths of a percent, UINT16_MAX when it does not fit
+ * e.g. when the interval is shorter than the one the statistics cover.
+ */
+uint16_t twi_poll_utilization(const struct twi_poll_stats *stats,
+                              uint32_t bit_rate, uint32_t elapsed_ms);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* !__TWI_POLL_H */
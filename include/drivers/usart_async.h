@@ -8,9 +8,23 @@
 #ifndef __USART_ASYNC_H
 #define __USART_ASYNC_H
 
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
 #include <stdint.h>
 #include <stdbool.h>
 #include <avr/io.h>
+#include "common/sleep_wait.h"
+#include "drivers/clock.h"
+
+/**
+ * @brief Maximum baud rate error accepted, in tenths of a percent. The C++
+ * driver checks it at compile time and usart_async_clock_changed at run time.
+ */
+#ifndef USART_MAX_BAUD_ERROR
+#define USART_MAX_BAUD_ERROR 25
+#endif /* !USART_MAX_BAUD_ERROR */
 
 /**
  * @brief Macro to get the value of the flags that indicate if there were errors
@@ -19,14 +33,29 @@
 #define USART_RX_ERROR (UCSR0A & (_BV(UPE0) | (_BV(DOR0) | _BV(FE0))))
 
 /**
- * @brief Number of data bits.
+ * @brief Bit used to encode the UCSZ02 bit, which lives in UCSR0B, into the
+ * character size.
+ */
+#define USART_UCSZ02_OFFSET 8
+
+/**
+ * @brief Bit that marks a 9-bit frame as an address frame in multi-processor
+ * communication mode.
+ */
+#define USART_ADDRESS_FRAME 0x100u
+
+/**
+ * @brief Number of data bits. The low byte holds the UCSR0C bits and the high
+ * byte holds the UCSR0B bits.
  */
 enum usart_character_size
 {
     USART_5_BITS,
     USART_6_BITS = _BV(UCSZ00),
     USART_7_BITS = _BV(UCSZ01),
-    USART_8_BITS = _BV(UCSZ00) | _BV(UCSZ01)
+    USART_8_BITS = _BV(UCSZ00) | _BV(UCSZ01),
+    USART_9_BITS = _BV(UCSZ00) | _BV(UCSZ01) |
+                   (_BV(UCSZ02) << USART_UCSZ02_OFFSET)
 };
 
 /**
@@ -51,6 +80,9 @@ enum usart_parity_mode
 /**
  * @brief USART configuration struct. It indicates frame format and if the
  * transmitter and receiver are enabled.
+ * @note When multi_processor is set the receiver ignores every frame that is
+ * not an address frame, use it with USART_9_BITS. double_speed halves the
+ * baud rate divider, which allows 2 Mbaud at 16 MHz.
  */
 struct usart_async_config
 {
@@ -59,6 +91,8 @@ struct usart_async_config
     enum usart_parity_mode parity;
     bool enable_tx;
     bool enable_rx;
+    bool multi_processor;
+    bool double_speed;
 };
 
 /**
@@ -67,23 +101,98 @@ struct usart_async_config
  */
 static inline void usart_transmit(uint8_t data)
 {
-    loop_until_bit_is_set(UCSR0A, UDRE0);
+    WAIT_UNTIL_BIT_IS_SET(UCSR0A, UDRE0, UCSR0B |= _BV(UDRIE0), usart_udre);
     UDR0 = data;
 }
 
+/**
+ * @brief Receives one byte.
+ * @return Received byte.
+ */
 static inline uint8_t usart_receive(void)
 {
-    loop_until_bit_is_set(UCSR0A, RXC0);
+    WAIT_UNTIL_BIT_IS_SET(UCSR0A, RXC0, UCSR0B |= _BV(RXCIE0), usart_rx);
     return UDR0;
 }
 
+/**
+ * @brief Transmits one 9-bit frame.
+ * @param data Frame to be transmitted, bit 8 is sent as the ninth bit.
+ */
+static inline void usart_transmit_9bit(uint16_t data)
+{
+    WAIT_UNTIL_BIT_IS_SET(UCSR0A, UDRE0, UCSR0B |= _BV(UDRIE0), usart_udre);
+    if (data & USART_ADDRESS_FRAME)
+    {
+        UCSR0B |= _BV(TXB80);
+    }
+    else
+    {
+        UCSR0B &= ~_BV(TXB80);
+    }
+    UDR0 = (uint8_t)data;
+}
+
+/**
+ * @brief Receives one 9-bit frame.
+ * @return Received frame, the ninth bit is returned in bit 8.
+ */
+static inline uint16_t usart_receive_9bit(void)
+{
+    WAIT_UNTIL_BIT_IS_SET(UCSR0A, RXC0, UCSR0B |= _BV(RXCIE0), usart_rx);
+    // RXB80 must be read before UDR0
+    uint16_t ninth = (UCSR0B & _BV(RXB80)) ? USART_ADDRESS_FRAME : 0;
+    return ninth | UDR0;
+}
+
+/**
+ * @brief Enables the receive complete interrupt (USART_RX_vect).
+ * @note When SDK_SLEEP_WAIT is defined, a program that defines its own
+ * USART_RX_vect must not use the blocking receive functions, which link the
+ * receive wake-up handler.
+ */
+static inline void usart_enable_rx_interrupt(void)
+{
+    UCSR0B |= _BV(RXCIE0);
+}
+
+/**
+ * @brief Disables the receive complete interrupt.
+ */
+static inline void usart_disable_rx_interrupt(void)
+{
+    UCSR0B &= ~_BV(RXCIE0);
+}
+
+/**
+ * @brief Enables or disables the multi-processor communication mode. While
+ * enabled, data frames are discarded by the receiver hardware.
+ * @param enable true to receive address frames only.
+ */
+static inline void usart_async_set_multi_processor(bool enable)
+{
+    // A read-modify-write would clear TXC0 by writing it back as one and
+    // write the error flags, which must be written as zero
+    UCSR0A = (UCSR0A & _BV(U2X0)) | (enable ? _BV(MPCM0) : 0);
+}
+
 /**
  * @brief Configures USART0 to operate in asynchronous mode.
  * @param config Configuration struct.
  * @param baud_rate Baud rate.
+ * @note The baud rate is set for the current system clock prescaler.
  */
 void usart_async_configure(struct usart_async_config config, uint32_t baudrate);
 
+/**
+ * @brief Retimes USART0 after a system clock change, register it with
+ * clock_register_listener.
+ * @param prescaler New system clock prescaler.
+ * @return false if the baud rate error is above USART_MAX_BAUD_ERROR. USART0
+ * is retimed anyway with the nearest divider.
+ */
+bool usart_async_clock_changed(enum clock_prescaler prescaler);
+
 /**
  * @brief Writes data to the tx buffer.
  * @param src Pointer to data source.
@@ -106,4 +215,27 @@ uint16_t usart_async_read(uint8_t *dst, uint16_t length);
  */
 void usart_async_put_string(const char * str);
 
+/**
+ * @brief Sends an address frame followed by data frames to a node on a
+ * multi-drop bus. USART0 must be configured with USART_9_BITS.
+ * @param address Node address.
+ * @param src Pointer to data source.
+ * @param length Number of bytes to write.
+ */
+void usart_async_write_to(uint8_t address, uint8_t *src, uint16_t length);
+
+/**
+ * @brief Enables the multi-processor communication mode and waits until an
+ * address frame that matches the node address is received, then the mode is
+ * disabled so that the following data frames reach usart_async_read.
+ * @param address Node address.
+ * @note Call it again after the message has been read to ignore the traffic
+ * addressed to other nodes.
+ */
+void usart_async_listen(uint8_t address);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
 #endif /* !__USART_ASYNC_H */
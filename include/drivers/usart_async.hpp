@@ -0,0 +1,267 @@
+/**
+ * @file usart_async.hpp
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 19:00
+ * @brief Header-only C++ driver for ATmega328p USART0 in asynchronous mode.
+ * The baud rate, the frame format and the buffer sizes are template parameters
+ * so the register values are computed and validated at compile time.
+ */
+
+#ifndef __USART_ASYNC_HPP
+#define __USART_ASYNC_HPP
+
+#include <avr/interrupt.h>
+#include "drivers/usart_async.h"
+
+#ifndef F_CPU
+#define F_CPU 16000000ul
+#warning "Using F_CPU=16000000ul for baud rate calculation as it has not been defined."
+#endif /* !F_CPU */
+
+namespace sdk
+{
+
+/**
+ * @brief Frame format.
+ * @tparam Size Number of data bits.
+ * @tparam Parity Parity mode.
+ * @tparam StopBits Number of stop bits.
+ */
+template <usart_character_size Size = USART_8_BITS,
+          usart_parity_mode Parity = USART_NO_PARITY,
+          usart_stop_bits StopBits = USART_ONE_STOP_BIT>
+struct UsartFrame
+{
+    static constexpr usart_character_size size = Size;
+    static constexpr uint8_t ucsr0b = Size >> USART_UCSZ02_OFFSET;
+    static constexpr uint8_t ucsr0c = (uint8_t)Size | Parity | StopBits;
+};
+
+/**
+ * @brief 8 data bits, no parity and one stop bit.
+ */
+using UsartFrame8N1 = UsartFrame<>;
+
+/**
+ * @brief USART0 driver.
+ * @tparam Baud Baud rate.
+ * @tparam Frame Frame format, see UsartFrame.
+ * @tparam RxBuf Receive buffer size, 0 to receive without interrupts.
+ * @tparam TxBuf Transmit buffer size, 0 to transmit without interrupts.
+ * @note Buffered instances need their interrupts to be routed with
+ * SDK_USART_ISR and global interrupts to be enabled. When SDK_SLEEP_WAIT is
+ * defined, buffer both directions or none, otherwise the unbuffered direction
+ * links a wake-up handler for a vector SDK_USART_ISR also defines.
+ */
+template <uint32_t Baud, class Frame = UsartFrame8N1, uint8_t RxBuf = 0,
+          uint8_t TxBuf = 0>
+class Usart
+{
+    static_assert((RxBuf & (RxBuf - 1)) == 0 && RxBuf <= 128,
+                  "RxBuf must be a power of two not greater than 128.");
+    static_assert((TxBuf & (TxBuf - 1)) == 0 && TxBuf <= 128,
+                  "TxBuf must be a power of two not greater than 128.");
+    static_assert(Frame::size != USART_9_BITS || (RxBuf == 0 && TxBuf == 0),
+                  "Buffered instances do not support 9-bit frames.");
+    static_assert(Baud > 0 && F_CPU / 8 / Baud >= 1,
+                  "Baud rate too high for F_CPU.");
+
+    // UBRR0 rounded to the nearest value in normal and double speed mode
+    static constexpr uint32_t ubrr_normal = (F_CPU + 8 * Baud) / (16 * Baud) - 1;
+    static constexpr uint32_t ubrr_double = (F_CPU + 4 * Baud) / (8 * Baud) - 1;
+
+    // Baud rate error in tenths of a percent
+    static constexpr uint32_t error(uint32_t divider, uint32_t ubrr)
+    {
+        return ubrr > 4095 ? UINT32_MAX
+               : F_CPU / (divider * (ubrr + 1)) > Baud
+                   ? (F_CPU / (divider * (ubrr + 1)) - Baud) * 1000 / Baud
+                   : (Baud - F_CPU / (divider * (ubrr + 1))) * 1000 / Baud;
+    }
+
+    // Double speed halves the receiver sampling, use it only when it helps
+    static constexpr bool double_speed =
+        error(8, ubrr_double) < error(16, ubrr_normal);
+
+    static_assert((double_speed ? error(8, ubrr_double)
+                                : error(16, ubrr_normal)) <=
+                      USART_MAX_BAUD_ERROR,
+                  "Baud rate error above USART_MAX_BAUD_ERROR.");
+
+public:
+    /** @brief UBRR0 value */
+    static constexpr uint16_t ubrr = double_speed ? ubrr_double : ubrr_normal;
+
+    /**
+     * @brief Configures USART0, enables the transmitter and the receiver.
+     */
+    static void configure()
+    {
+        UBRR0 = ubrr;
+        UCSR0A = double_speed ? _BV(U2X0) : 0;
+        UCSR0C = Frame::ucsr0c;
+        UCSR0B = _BV(TXEN0) | _BV(RXEN0) | Frame::ucsr0b |
+                 (RxBuf ? _BV(RXCIE0) : 0);
+    }
+
+    /**
+     * @brief Transmits one byte, it only waits if the buffer is full.
+     * @param data Byte to be transmitted.
+     */
+    static void write(uint8_t data)
+    {
+        if constexpr (TxBuf == 0)
+        {
+            usart_transmit(data);
+        }
+        else
+        {
+            uint8_t next = (tx_tail + 1) & (TxBuf - 1);
+            while (next == tx_head);
+            tx_buffer[tx_tail] = data;
+            tx_tail = next;
+            UCSR0B |= _BV(UDRIE0);
+        }
+    }
+
+    /**
+     * @brief Transmits a sequence of bytes.
+     * @param src Pointer to data source.
+     * @param length Number of bytes to write.
+     */
+    static void write(const uint8_t *src, uint16_t length)
+    {
+        for (uint16_t i = 0; i < length; i++) write(src[i]);
+    }
+
+    /**
+     * @brief Transmits a zero-terminated string.
+     * @param str String.
+     */
+    static void put_string(const char *str)
+    {
+        while (*str) write((uint8_t)*str++);
+    }
+
+    /**
+     * @brief Checks if there is received data waiting to be read.
+     * @return true if read will not wait.
+     */
+    static bool available()
+    {
+        if constexpr (RxBuf == 0)
+        {
+            return bit_is_set(UCSR0A, RXC0);
+        }
+        else
+        {
+            return rx_head != rx_tail;
+        }
+    }
+
+    /**
+     * @brief Receives one byte, it waits until one is available.
+     * @return Received byte.
+     */
+    static uint8_t read()
+    {
+        if constexpr (RxBuf == 0)
+        {
+            return usart_receive();
+        }
+        else
+        {
+            while (rx_head == rx_tail);
+            uint8_t data = rx_buffer[rx_head];
+            rx_head = (rx_head + 1) & (RxBuf - 1);
+            return data;
+        }
+    }
+
+    /**
+     * @brief Receives a sequence of bytes, like usart_async_read it stops at the
+     * first frame, data overrun or parity error.
+     * @param dst Pointer to data destination.
+     * @param length Number of bytes to read.
+     * @return Number of bytes read before an error.
+     * @note Buffered instances do not detect errors and always read length
+     * bytes.
+     */
+    static uint16_t read(uint8_t *dst, uint16_t length)
+    {
+        uint16_t i = 0;
+        for (i = 0; i < length; i++)
+        {
+            dst[i] = read();
+            if constexpr (RxBuf == 0)
+            {
+                if (USART_RX_ERROR) break;
+            }
+        }
+        return i;
+    }
+
+    /**
+     * @brief Receive complete interrupt handler.
+     */
+    static void rx_isr()
+    {
+        uint8_t data = UDR0;
+        if constexpr (RxBuf != 0)
+        {
+            uint8_t next = (rx_tail + 1) & (RxBuf - 1);
+            // Bytes are dropped when the buffer is full
+            if (next != rx_head)
+            {
+                rx_buffer[rx_tail] = data;
+                rx_tail = next;
+            }
+        }
+    }
+
+    /**
+     * @brief Data register empty interrupt handler.
+     */
+    static void udre_isr()
+    {
+        if constexpr (TxBuf != 0)
+        {
+            if (tx_head == tx_tail)
+            {
+                UCSR0B &= ~_BV(UDRIE0);
+                return;
+            }
+            UDR0 = tx_buffer[tx_head];
+            tx_head = (tx_head + 1) & (TxBuf - 1);
+        }
+        else
+        {
+            UCSR0B &= ~_BV(UDRIE0);
+        }
+    }
+
+private:
+    static inline uint8_t rx_buffer[RxBuf ? RxBuf : 1];
+    static inline volatile uint8_t rx_head;
+    static inline volatile uint8_t rx_tail;
+    static inline uint8_t tx_buffer[TxBuf ? TxBuf : 1];
+    static inline volatile uint8_t tx_head;
+    static inline volatile uint8_t tx_tail;
+};
+
+} // namespace sdk
+
+/**
+ * @brief Routes the USART0 interrupts to a buffered Usart instance.
+ */
+#define SDK_USART_ISR(USART)                                                  \
+    ISR(USART_RX_vect)                                                        \
+    {                                                                         \
+        USART::rx_isr();                                                      \
+    }                                                                         \
+    ISR(USART_UDRE_vect)                                                      \
+    {                                                                         \
+        USART::udre_isr();                                                    \
+    }
+
+#endif /* !__USART_ASYNC_HPP */
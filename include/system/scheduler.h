@@ -0,0 +1,163 @@
+/**
+ * @file scheduler.h
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 10:00
+ * @brief Cooperative run-to-completion event scheduler. Events are posted to
+ * fixed-size queues, one per priority level, and dispatched from the main loop.
+ * Timer/Counter 0 generates the scheduler tick.
+ */
+
+#ifndef __SCHEDULER_H
+#define __SCHEDULER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <avr/interrupt.h>
+#include "drivers/clock.h"
+
+/**
+ * @brief Number of events each priority queue can hold, it must be a power of
+ * two.
+ */
+#ifndef SCHEDULER_QUEUE_SIZE
+#define SCHEDULER_QUEUE_SIZE 8
+#endif /* !SCHEDULER_QUEUE_SIZE */
+
+/**
+ * @brief Maximum number of pending timer events.
+ */
+#ifndef SCHEDULER_MAX_TIMERS
+#define SCHEDULER_MAX_TIMERS 8
+#endif /* !SCHEDULER_MAX_TIMERS */
+
+/**
+ * @brief Dispatch latency, in Timer/Counter 0 counts, above which an event is
+ * counted as an overrun. A count lasts 4 us at 16 MHz.
+ */
+#ifndef SCHEDULER_LATENCY_BOUND
+#define SCHEDULER_LATENCY_BOUND 250
+#endif /* !SCHEDULER_LATENCY_BOUND */
+
+/**
+ * @brief Scheduler tick frequency in Hz.
+ */
+#define SCHEDULER_TICK_HZ 1000ul
+
+/**
+ * @brief Converts milliseconds to scheduler ticks.
+ */
+#define SCHEDULER_MS(MS) ((uint16_t)((MS) * SCHEDULER_TICK_HZ / 1000ul))
+
+/**
+ * @brief Defines an interrupt service routine that posts an event. This lets a
+ * peripheral interrupt feed the scheduler directly e.g.
+ * SCHEDULER_EVENT_SOURCE(USART_RX_vect, on_byte, EVENT_PRIORITY_HIGH, UDR0).
+ * @note ARG is evaluated inside the ISR, it must clear the interrupt flag if
+ * the hardware does not do it by itself.
+ */
+#define SCHEDULER_EVENT_SOURCE(VECTOR, HANDLER, PRIORITY, ARG)                \
+    ISR(VECTOR)                                                               \
+    {                                                                         \
+        scheduler_post((HANDLER), (ARG), (PRIORITY));                         \
+    }
+
+/**
+ * @brief Event priority levels, lower values are dispatched first.
+ */
+enum event_priority
+{
+    EVENT_PRIORITY_HIGH,
+    EVENT_PRIORITY_NORMAL,
+    EVENT_PRIORITY_LOW,
+    EVENT_PRIORITY_LEVELS
+};
+
+/**
+ * @brief Event handler, it must run to completion without blocking.
+ */
+typedef void (*event_handler_t)(uint8_t arg);
+
+/**
+ * @brief Scheduler statistics.
+ */
+struct scheduler_stats
+{
+    /** @brief Worst post-to-dispatch latency in timer counts */
+    uint16_t max_latency;
+    /** @brief Events dispatched later than SCHEDULER_LATENCY_BOUND */
+    uint16_t overruns;
+    /** @brief Events lost because a queue or the timer list was full */
+    uint16_t dropped;
+};
+
+/**
+ * @brief Initializes the event queues and starts the tick timer.
+ * @note Global interrupts must be enabled for the tick to run.
+ */
+void scheduler_init(void);
+
+/**
+ * @brief Posts an event. It can be called from the main loop and from
+ * interrupt service routines.
+ * @param handler Event handler.
+ * @param arg Argument passed to the handler.
+ * @param priority Event priority.
+ * @return true if the event was queued.
+ */
+bool scheduler_post(event_handler_t handler, uint8_t arg,
+                    enum event_priority priority);
+
+/**
+ * @brief Posts an event once a number of ticks have elapsed. Pending timer
+ * events are kept ordered by deadline.
+ * @param handler Event handler.
+ * @param arg Argument passed to the handler.
+ * @param priority Event priority.
+ * @param delay Delay in ticks, see SCHEDULER_MS.
+ * @return true if the timer event was registered.
+ */
+bool scheduler_post_delayed(event_handler_t handler, uint8_t arg,
+                            enum event_priority priority, uint16_t delay);
+
+/**
+ * @brief Dispatches the highest priority pending event.
+ * @return false if there were no pending events.
+ */
+bool scheduler_dispatch(void);
+
+/**
+ * @brief Dispatches events forever and puts the CPU in idle sleep mode
+ * whenever the queues are empty.
+ */
+void scheduler_run(void) __attribute__((noreturn));
+
+/**
+ * @brief Gets the number of ticks since scheduler_init was called.
+ * @return Tick counter, it wraps around.
+ */
+uint16_t scheduler_ticks(void);
+
+/**
+ * @brief Retimes the tick after a system clock change, register it with
+ * clock_register_listener. Latency figures are expressed in counts of the
+ * new timer configuration afterwards.
+ * @param prescaler New system clock prescaler.
+ * @return true, every prescaler has an exact tick configuration.
+ */
+bool scheduler_clock_changed(enum clock_prescaler prescaler);
+
+/**
+ * @brief Gets a copy of the scheduler statistics.
+ * @param stats Statistics destination.
+ */
+void scheduler_get_stats(struct scheduler_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* !__SCHEDULER_H */
@@ -0,0 +1,154 @@
+/**
+ * @file stack_monitor.h
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 20:00
+ * @brief SRAM and stack usage instrumentation. The free SRAM between the end
+ * of the static data and the top of the stack is painted with a known pattern
+ * at start-up, so the stack high-water mark can be found at any time.
+ */
+
+#ifndef __STACK_MONITOR_H
+#define __STACK_MONITOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <avr/io.h>
+
+/**
+ * @brief Value written to unused SRAM at start-up.
+ */
+#define STACK_MONITOR_CANARY 0xC5
+
+/**
+ * @brief Number of sample points that can be tracked by STACK_MONITOR_SAMPLE.
+ */
+#ifndef STACK_MONITOR_SLOTS
+#define STACK_MONITOR_SLOTS 4
+#endif /* !STACK_MONITOR_SLOTS */
+
+/**
+ * @brief Number of bytes below the entry stack pointer painted by
+ * STACK_MONITOR_ISR_BEGIN. It must be smaller than the free SRAM reported by
+ * stack_monitor_get.
+ */
+#ifndef STACK_MONITOR_ISR_WINDOW
+#define STACK_MONITOR_ISR_WINDOW 64
+#endif /* !STACK_MONITOR_ISR_WINDOW */
+
+/**
+ * @brief Records the stack depth at this point of the program if it is the
+ * deepest seen so far for the slot.
+ * @note It only measures the depth at the point where it is placed. To get
+ * the peak of an ISR it must also be placed in the deepest call path of the
+ * ISR, or STACK_MONITOR_ISR_BEGIN and STACK_MONITOR_ISR_END can be used
+ * instead.
+ */
+#define STACK_MONITOR_SAMPLE(SLOT)                                            \
+    do                                                                        \
+    {                                                                         \
+        uint16_t stack_monitor_depth = RAMEND - SP;                           \
+        if (stack_monitor_depth > stack_monitor_peaks[(SLOT)])                \
+        {                                                                     \
+            stack_monitor_peaks[(SLOT)] = stack_monitor_depth;                \
+        }                                                                     \
+    } while (0)
+
+/**
+ * @brief Paints up to STACK_MONITOR_ISR_WINDOW bytes below the stack pointer,
+ * never below the heap or the static data. It must be the first statement of
+ * an ISR, paired with STACK_MONITOR_ISR_END.
+ * @note The deepest stack address already used in the window is saved before
+ * it is painted again, so the peak reported by stack_monitor_get still
+ * includes it.
+ * @note Every interrupt pays for a call that scans the window, a paint of the
+ * window and a second scan in STACK_MONITOR_ISR_END, about 64 bytes each with
+ * the default window or several hundred cycles. The call also makes the ISR
+ * save every call-clobbered register. It is meant for development builds,
+ * not for ISRs with tight latency requirements.
+ */
+#define STACK_MONITOR_ISR_BEGIN()                                             \
+    uint16_t stack_monitor_entry_sp = SP;                                     \
+    uint16_t stack_monitor_bottom =                                           \
+        stack_monitor_isr_begin(stack_monitor_entry_sp);                      \
+    for (volatile uint8_t *stack_monitor_p =                                  \
+             (volatile uint8_t *)stack_monitor_entry_sp;                      \
+         stack_monitor_p >= (volatile uint8_t *)stack_monitor_bottom;         \
+         stack_monitor_p--)                                                   \
+    *stack_monitor_p = STACK_MONITOR_CANARY
+
+/**
+ * @brief Scans the window painted by STACK_MONITOR_ISR_BEGIN and records the
+ * peak depth reached by the ISR, including the functions it called, if it is
+ * the deepest seen so far for the slot. It must be the last statement of the
+ * ISR.
+ * @note The peak saturates at the bottom of the window.
+ */
+#define STACK_MONITOR_ISR_END(SLOT)                                           \
+    do                                                                        \
+    {                                                                         \
+        volatile uint8_t *stack_monitor_p =                                   \
+            (volatile uint8_t *)stack_monitor_bottom;                         \
+        while (stack_monitor_p <= (volatile uint8_t *)stack_monitor_entry_sp \
+               && *stack_monitor_p == STACK_MONITOR_CANARY)                   \
+        {                                                                     \
+            stack_monitor_p++;                                                \
+        }                                                                     \
+        uint16_t stack_monitor_depth =                                        \
+            RAMEND + 1 - (uint16_t)stack_monitor_p;                           \
+        if (stack_monitor_depth > stack_monitor_peaks[(SLOT)])                \
+        {                                                                     \
+            stack_monitor_peaks[(SLOT)] = stack_monitor_depth;                \
+        }                                                                     \
+    } while (0)
+
+/**
+ * @brief SRAM usage in bytes.
+ */
+struct stack_usage
+{
+    /** @brief Deepest stack usage since reset */
+    uint16_t peak;
+    /** @brief Current stack usage */
+    uint16_t current;
+    /** @brief Current gap between the heap or static data and the stack */
+    uint16_t free;
+    /** @brief Smallest gap since reset, it must never reach zero */
+    uint16_t min_free;
+};
+
+/**
+ * @brief Deepest stack depth recorded by each STACK_MONITOR_SAMPLE slot.
+ */
+extern volatile uint16_t stack_monitor_peaks[STACK_MONITOR_SLOTS];
+
+/**
+ * @brief Used by STACK_MONITOR_ISR_BEGIN. It saves the deepest address already
+ * used in the window below the entry stack pointer and gets the bottom of the
+ * window, clamped above the heap and the static data.
+ * @param entry_sp Stack pointer at the start of the ISR.
+ * @return Lowest address to be painted.
+ */
+uint16_t stack_monitor_isr_begin(uint16_t entry_sp);
+
+/**
+ * @brief Measures the SRAM usage. It scans the painted area, so its execution
+ * time grows with the amount of free SRAM.
+ * @param usage Measurements destination.
+ */
+void stack_monitor_get(struct stack_usage *usage);
+
+/**
+ * @brief Transmits the SRAM usage and the sample slots through USART0 as a
+ * line of text.
+ * @note USART0 must have been configured with usart_async_configure.
+ */
+void stack_monitor_report(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* !__STACK_MONITOR_H */
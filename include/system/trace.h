@@ -0,0 +1,126 @@
+/**
+ * @file trace.h
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 17:20
+ * @brief Deferred binary trace logging. Call sites store a message ID and the
+ * raw argument bytes in a ring buffer which is drained through USART0 when
+ * the CPU is idle. Format strings are kept in the .trace_fmt section, which is
+ * not loaded into flash, and tools/trace/trace_decode.py rebuilds the messages
+ * on the host.
+ *
+ * Each record is sent as a length byte, the little-endian 16-bit message ID
+ * and the arguments. The length counts the ID and the arguments.
+ */
+
+#ifndef __TRACE_H
+#define __TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+
+/**
+ * @brief Size of the trace ring buffer, it must be a power of two.
+ */
+#ifndef TRACE_BUFFER_SIZE
+#define TRACE_BUFFER_SIZE 64
+#endif /* !TRACE_BUFFER_SIZE */
+
+#ifndef NTRACE
+
+/**
+ * @brief Places a format string in the .trace_fmt section and evaluates to its
+ * message ID, which is the offset of the string within the section.
+ */
+#define TRACE_ID(FMT)                                                         \
+    __extension__({                                                           \
+        static const char trace_fmt[]                                         \
+            __attribute__((section(".trace_fmt"), used)) = FMT;               \
+        (uint16_t)(uintptr_t)trace_fmt;                                       \
+    })
+
+/**
+ * @brief Emits a trace record without arguments.
+ */
+#define TRACE0(FMT) trace_record(TRACE_ID(FMT), 0, 0)
+
+/**
+ * @brief Emits a trace record with one argument. The argument size must match
+ * its conversion: hh for 1 byte, none for 2 bytes and l for 4 bytes. %c takes 1
+ * byte, a character literal is an int in C so it must be cast e.g.
+ * TRACE1("key %c", (char)'q').
+ */
+#define TRACE1(FMT, A)                                                        \
+    do                                                                        \
+    {                                                                         \
+        __typeof__(A) trace_args = (A);                                       \
+        trace_record(TRACE_ID(FMT), &trace_args, sizeof(trace_args));         \
+    } while (0)
+
+/**
+ * @brief Emits a trace record with two arguments.
+ */
+#define TRACE2(FMT, A, B)                                                     \
+    do                                                                        \
+    {                                                                         \
+        struct __attribute__((packed))                                        \
+        {                                                                     \
+            __typeof__(A) a;                                                  \
+            __typeof__(B) b;                                                  \
+        } trace_args = {(A), (B)};                                            \
+        trace_record(TRACE_ID(FMT), &trace_args, sizeof(trace_args));         \
+    } while (0)
+
+/**
+ * @brief Emits a trace record with three arguments.
+ */
+#define TRACE3(FMT, A, B, C)                                                  \
+    do                                                                        \
+    {                                                                         \
+        struct __attribute__((packed))                                        \
+        {                                                                     \
+            __typeof__(A) a;                                                  \
+            __typeof__(B) b;                                                  \
+            __typeof__(C) c;                                                  \
+        } trace_args = {(A), (B), (C)};                                       \
+        trace_record(TRACE_ID(FMT), &trace_args, sizeof(trace_args));         \
+    } while (0)
+
+#else
+
+#define TRACE0(FMT) do {} while (0)
+#define TRACE1(FMT, A) do {} while (0)
+#define TRACE2(FMT, A, B) do {} while (0)
+#define TRACE3(FMT, A, B, C) do {} while (0)
+
+#endif /* !NTRACE */
+
+/**
+ * @brief Stores a trace record in the ring buffer. It can be called from
+ * interrupt service routines. The record is dropped if it does not fit.
+ * @param id Message ID.
+ * @param args Raw argument bytes.
+ * @param length Number of argument bytes.
+ */
+void trace_record(uint16_t id, const void *args, uint8_t length);
+
+/**
+ * @brief Moves buffered bytes to USART0 while its data register is empty. It
+ * never waits, call it from the idle loop.
+ * @note USART0 must have been configured with usart_async_configure.
+ */
+void trace_flush(void);
+
+/**
+ * @brief Gets the number of records dropped because the buffer was full.
+ * @return Dropped records.
+ */
+uint16_t trace_dropped(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* !__TRACE_H */
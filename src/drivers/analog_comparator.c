@@ -0,0 +1,55 @@
+/**
+ * @file analog_comparator.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 20:40
+ * @brief ATmega328P analog comparator driver.
+ */
+
+#include "drivers/analog_comparator.h"
+
+void analog_comparator_configure(struct ac_config config)
+{
+    // Changing ACIS or the inputs can trigger an interrupt
+    ACSR &= ~_BV(ACIE);
+
+    if (config.negative & AC_ADC_MUX)
+    {
+        ADCSRA &= ~_BV(ADEN);
+        ADMUX = (ADMUX & 0xF0) | (config.negative & 0x07);
+        ADCSRB |= _BV(ACME);
+        // ADC6 and ADC7 are analog only and have no digital input buffer
+        if ((config.negative & 0x07) < 6) DIDR0 |= _BV(config.negative & 0x07);
+        DIDR1 &= ~_BV(AIN1D);
+    }
+    else
+    {
+        ADCSRB &= ~_BV(ACME);
+        DIDR1 |= _BV(AIN1D);
+    }
+    if (config.positive == AC_POSITIVE_AIN0)
+    {
+        DIDR1 |= _BV(AIN0D);
+    }
+    else
+    {
+        DIDR1 &= ~_BV(AIN0D);
+    }
+
+    if (config.enable_input_capture)
+    {
+        TCCR1B = (TCCR1B & ~(_BV(ICES1) | _BV(ICNC1))) | config.capture_edge |
+                 (config.capture_noise_canceler << ICNC1);
+        // Changing the edge can set the input capture flag
+        TIFR1 = _BV(ICF1);
+    }
+
+    // Writing a logic one to ACI clears a pending interrupt
+    ACSR = config.positive | config.interrupt_mode |
+           (config.enable_input_capture << ACIC) | _BV(ACI);
+    if (config.enable_interrupt) ACSR |= _BV(ACIE);
+}
+
+void analog_comparator_disable(void)
+{
+    ACSR = _BV(ACD) | _BV(ACI);
+}
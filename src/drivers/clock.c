@@ -0,0 +1,49 @@
+/**
+ * @file clock.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 22:40
+ * @brief ATmega328P system clock prescaler driver.
+ */
+
+#include <avr/io.h>
+#include <avr/power.h>
+#include "drivers/clock.h"
+
+#ifndef F_CPU
+#define F_CPU 16000000ul
+#warning "Using F_CPU=16000000ul for clock frequency calculation as it has not been defined."
+#endif /* !F_CPU */
+
+static clock_listener_t listeners[CLOCK_MAX_LISTENERS];
+static uint8_t listener_count;
+
+bool clock_register_listener(clock_listener_t listener)
+{
+    if (listener_count == CLOCK_MAX_LISTENERS) return false;
+    listeners[listener_count++] = listener;
+    return true;
+}
+
+bool clock_set_prescaler(enum clock_prescaler prescaler)
+{
+    // CLKPS must be written within four cycles after CLKPCE, avr-libc does
+    // it in assembly with interrupts disabled so it works at any optimization
+    // level
+    clock_prescale_set((clock_div_t)prescaler);
+    bool in_tolerance = true;
+    for (uint8_t i = 0; i < listener_count; i++)
+    {
+        if (!listeners[i](prescaler)) in_tolerance = false;
+    }
+    return in_tolerance;
+}
+
+enum clock_prescaler clock_get_prescaler(void)
+{
+    return (enum clock_prescaler)(CLKPR & 0x0F);
+}
+
+uint32_t clock_get_frequency(void)
+{
+    return F_CPU >> clock_get_prescaler();
+}
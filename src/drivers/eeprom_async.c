@@ -0,0 +1,305 @@
+/**
+ * @file eeprom_async.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 15:05
+ * @brief ATmega328P EEPROM driver. Writes are queued and committed in the
+ * background from the EEPROM ready interrupt.
+ */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include "drivers/eeprom_async.h"
+
+#if (EEPROM_ASYNC_QUEUE_SIZE & (EEPROM_ASYNC_QUEUE_SIZE - 1)) != 0
+#error "EEPROM_ASYNC_QUEUE_SIZE must be a power of two."
+#endif
+
+#if (EEPROM_ASYNC_CACHE_SIZE & (EEPROM_ASYNC_CACHE_SIZE - 1)) != 0
+#error "EEPROM_ASYNC_CACHE_SIZE must be a power of two."
+#endif
+
+#define QUEUE_MASK (EEPROM_ASYNC_QUEUE_SIZE - 1)
+#define CACHE_MASK (EEPROM_ASYNC_CACHE_SIZE - 1)
+
+/**
+ * @brief EEPROM programming modes.
+ */
+enum eeprom_mode
+{
+    EEPROM_ERASE_AND_WRITE,
+    EEPROM_ERASE_ONLY = _BV(EEPM0),
+    EEPROM_WRITE_ONLY = _BV(EEPM1)
+};
+
+/**
+ * @brief Byte waiting to be written.
+ */
+struct eeprom_entry
+{
+    uint16_t address;
+    uint8_t value;
+};
+
+/**
+ * @brief Read cache entry. The tag holds the address plus one so that the
+ * zero-initialized cache starts empty.
+ */
+struct cache_entry
+{
+    uint16_t tag;
+    uint8_t value;
+};
+
+static struct eeprom_entry queue[EEPROM_ASYNC_QUEUE_SIZE];
+static volatile uint8_t queue_head;
+static volatile uint8_t queue_tail;
+
+static struct cache_entry cache[EEPROM_ASYNC_CACHE_SIZE];
+
+/**
+ * @brief Reads one byte straight from the EEPROM.
+ */
+static uint8_t eeprom_read_cell(uint16_t address)
+{
+    while (true)
+    {
+        loop_until_bit_is_clear(EECR, EEPE);
+        // The EEPROM ready interrupt also uses the address register
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            if (bit_is_clear(EECR, EEPE))
+            {
+                EEAR = address;
+                EECR |= _BV(EERE);
+                return EEDR;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Looks for a queued byte, it must be called with interrupts disabled.
+ * @return Pointer to the most recent entry or NULL.
+ */
+static struct eeprom_entry *queue_find(uint16_t address)
+{
+    struct eeprom_entry *found = 0;
+    for (uint8_t i = queue_head; i != queue_tail; i = (i + 1) & QUEUE_MASK)
+    {
+        if (queue[i].address == address) found = &queue[i];
+    }
+    return found;
+}
+
+/**
+ * @brief Stores a byte in the read cache.
+ */
+static inline void cache_fill(uint16_t address, uint8_t value)
+{
+    struct cache_entry *entry = &cache[address & CACHE_MASK];
+    entry->tag = address + 1u;
+    entry->value = value;
+}
+
+/**
+ * @brief Gets one byte from the cache, the queue or the EEPROM if it is not
+ * busy.
+ * @return false if the byte could only be read by waiting for the ongoing
+ * write.
+ */
+static bool eeprom_peek(uint16_t address, uint8_t *value)
+{
+    struct cache_entry *entry = &cache[address & CACHE_MASK];
+    if (entry->tag == address + 1u)
+    {
+        *value = entry->value;
+        return true;
+    }
+
+    bool found = false;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        struct eeprom_entry *queued = queue_find(address);
+        if (queued)
+        {
+            *value = queued->value;
+            found = true;
+        }
+        else if (bit_is_clear(EECR, EEPE))
+        {
+            EEAR = address;
+            EECR |= _BV(EERE);
+            *value = EEDR;
+            found = true;
+        }
+    }
+    if (found) cache_fill(address, *value);
+    return found;
+}
+
+/**
+ * @brief Reads one byte through the cache and the queue.
+ */
+static uint8_t eeprom_read_byte_cached(uint16_t address)
+{
+    uint8_t value;
+    if (!eeprom_peek(address, &value))
+    {
+        value = eeprom_read_cell(address);
+        cache_fill(address, value);
+    }
+    return value;
+}
+
+/**
+ * @brief Queues one byte unless the EEPROM already holds it.
+ * @return false if the queue is full.
+ */
+static bool eeprom_write_byte_queued(uint16_t address, uint8_t value)
+{
+    // When the EEPROM is busy the comparison is left to the interrupt
+    uint8_t current;
+    if (eeprom_peek(address, &current) && current == value) return true;
+
+    bool queued = true;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        struct eeprom_entry *entry = queue_find(address);
+        if (entry)
+        {
+            // Coalesce with the byte that has not been committed yet
+            entry->value = value;
+        }
+        else
+        {
+            uint8_t next = (queue_tail + 1) & QUEUE_MASK;
+            if (next == queue_head)
+            {
+                queued = false;
+            }
+            else
+            {
+                queue[queue_tail] = (struct eeprom_entry){address, value};
+                queue_tail = next;
+                EECR |= _BV(EERIE);
+            }
+        }
+    }
+    if (queued) cache_fill(address, value);
+    return queued;
+}
+
+uint16_t eeprom_async_write(uint16_t address, const uint8_t *src,
+                            uint16_t length)
+{
+    uint16_t i;
+    for (i = 0; i < length; i++)
+    {
+        if (!eeprom_write_byte_queued(address + i, *(src + i))) break;
+    }
+    return i;
+}
+
+void eeprom_async_read(uint16_t address, uint8_t *dst, uint16_t length)
+{
+    for (uint16_t i = 0; i < length; i++)
+    {
+        *(dst + i) = eeprom_read_byte_cached(address + i);
+    }
+}
+
+bool eeprom_async_busy(void)
+{
+    return queue_head != queue_tail || bit_is_set(EECR, EEPE);
+}
+
+void eeprom_async_flush(void)
+{
+    while (eeprom_async_busy());
+}
+
+void eeprom_ring_init(struct eeprom_ring *ring, uint16_t address, uint8_t size,
+                      uint8_t length)
+{
+    ring->address = address;
+    ring->size = size;
+    ring->length = length;
+    ring->index = 0;
+
+    // Status bytes are consecutive counters, the last slot written is the one
+    // whose successor does not continue the sequence
+    uint16_t status = address + (uint16_t)size * length;
+    uint8_t previous;
+    eeprom_async_read(status, &previous, 1);
+    for (uint8_t i = 1; i < length; i++)
+    {
+        uint8_t current;
+        eeprom_async_read(status + i, &current, 1);
+        if (current != (uint8_t)(previous + 1)) break;
+        previous = current;
+        ring->index = i;
+    }
+}
+
+void eeprom_ring_read(const struct eeprom_ring *ring, void *dst)
+{
+    eeprom_async_read(ring->address + (uint16_t)ring->size * ring->index,
+                      (uint8_t *)dst, ring->size);
+}
+
+bool eeprom_ring_write(struct eeprom_ring *ring, const void *src)
+{
+    uint16_t status = ring->address + (uint16_t)ring->size * ring->length;
+    uint8_t next = ring->index + 1 < ring->length ? ring->index + 1 : 0;
+    uint8_t sequence;
+    eeprom_async_read(status + ring->index, &sequence, 1);
+    sequence++;
+
+    // The status byte is queued after the value, so it is committed last
+    if (eeprom_async_write(ring->address + (uint16_t)ring->size * next,
+                           (const uint8_t *)src, ring->size) != ring->size)
+    {
+        return false;
+    }
+    if (eeprom_async_write(status + next, &sequence, 1) != 1) return false;
+    ring->index = next;
+    return true;
+}
+
+ISR(EE_READY_vect)
+{
+    while (queue_head != queue_tail)
+    {
+        struct eeprom_entry entry = queue[queue_head];
+        queue_head = (queue_head + 1) & QUEUE_MASK;
+
+        EEAR = entry.address;
+        EECR |= _BV(EERE);
+        uint8_t current = EEDR;
+        if (current == entry.value) continue;
+
+        // Skip the erase when no bit goes from zero to one and the write when
+        // the cell only has to be erased
+        enum eeprom_mode mode = EEPROM_ERASE_AND_WRITE;
+        if (entry.value == 0xFF)
+        {
+            mode = EEPROM_ERASE_ONLY;
+        }
+        else if ((current & entry.value) == entry.value)
+        {
+            mode = EEPROM_WRITE_ONLY;
+        }
+        EECR = (EECR & ~(_BV(EEPM1) | _BV(EEPM0))) | mode;
+        EEDR = entry.value;
+        // EEPE must be set within four cycles of EEMPE, two sbi instructions
+        // meet that at any optimization level
+        __asm__ volatile("sbi %[eecr], %[eempe]\n\t"
+                         "sbi %[eecr], %[eepe]"
+                         :
+                         : [eecr] "I"(_SFR_IO_ADDR(EECR)),
+                           [eempe] "I"(EEMPE), [eepe] "I"(EEPE));
+        return;
+    }
+    EECR &= ~_BV(EERIE);
+}
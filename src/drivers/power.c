@@ -0,0 +1,39 @@
+/**
+ * @file power.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 13:40
+ * @brief ATmega328P power management driver.
+ */
+
+#include <stdbool.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include "drivers/power.h"
+
+/**
+ * @brief Enters the selected sleep mode.
+ */
+static void enter_sleep_mode(uint8_t mode, bool disable_bod)
+{
+    set_sleep_mode(mode);
+    cli();
+    sleep_enable();
+    if (disable_bod)
+    {
+        // BODS is cleared three cycles after being set
+        sleep_bod_disable();
+    }
+    sei();
+    sleep_cpu();
+    sleep_disable();
+}
+
+void power_idle(void)
+{
+    enter_sleep_mode(SLEEP_MODE_IDLE, false);
+}
+
+void power_down(void)
+{
+    enter_sleep_mode(SLEEP_MODE_PWR_DOWN, true);
+}
@@ -0,0 +1,18 @@
+/**
+ * @file sleep_wait_twi.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 13:10
+ * @brief 2-wire serial interface wake-up handler for SDK_SLEEP_WAIT.
+ */
+
+#include "common/sleep_wait.h"
+
+#ifdef SDK_SLEEP_WAIT
+SLEEP_WAIT_ANCHOR(twi);
+
+ISR(TWI_vect)
+{
+    // Writing a logic one to TWINT would start the next bus operation
+    TWCR &= ~(_BV(TWIE) | _BV(TWINT));
+}
+#endif /* SDK_SLEEP_WAIT */
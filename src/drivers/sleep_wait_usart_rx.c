@@ -0,0 +1,18 @@
+/**
+ * @file sleep_wait_usart_rx.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 13:10
+ * @brief USART0 receive complete wake-up handler for SDK_SLEEP_WAIT.
+ */
+
+#include "common/sleep_wait.h"
+
+#ifdef SDK_SLEEP_WAIT
+SLEEP_WAIT_ANCHOR(usart_rx);
+
+ISR(USART_RX_vect)
+{
+    // The blocking call reads UDR0 after waking up
+    UCSR0B &= ~_BV(RXCIE0);
+}
+#endif /* SDK_SLEEP_WAIT */
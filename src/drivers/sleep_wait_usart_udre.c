@@ -0,0 +1,17 @@
+/**
+ * @file sleep_wait_usart_udre.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 13:10
+ * @brief USART0 data register empty wake-up handler for SDK_SLEEP_WAIT.
+ */
+
+#include "common/sleep_wait.h"
+
+#ifdef SDK_SLEEP_WAIT
+SLEEP_WAIT_ANCHOR(usart_udre);
+
+ISR(USART_UDRE_vect)
+{
+    UCSR0B &= ~_BV(UDRIE0);
+}
+#endif /* SDK_SLEEP_WAIT */
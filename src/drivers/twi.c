@@ -12,15 +12,95 @@
 #warning "Using F_CPU=16000000ul for bit rate calculation as it has not been defined."
 #endif /* !F_CPU */
 
-#define TWI_PRESCALER 1.0f
+// Each polling iteration takes at least four cycles, so the timeouts are
+// never shorter than TWI_TIMEOUT_US and TWI_PROBE_TIMEOUT_US
+#define TWI_TIMEOUT_LOOPS (F_CPU / 1000000ul * TWI_TIMEOUT_US / 4)
+#define TWI_PROBE_TIMEOUT_LOOPS (F_CPU / 1000000ul * TWI_PROBE_TIMEOUT_US / 4)
+
+// SCL period in CPU cycles for the undivided clock
+static uint16_t scl_cycles;
 
 void twi_configure(uint32_t bit_rate)
 {
     TWSR = TWI_PRESCALER_VALUE_1;
-    float br = (((float)F_CPU / (float)bit_rate) - 16.0f) /
-               (2.0f * TWI_PRESCALER);
-    TWBR = (uint8_t)br;
     TWCR = 0;
+    scl_cycles = F_CPU / bit_rate;
+    // TWBR is set for the current prescaler, not only for the undivided clock
+    twi_clock_changed(clock_get_prescaler());
+}
+
+bool twi_clock_changed(enum clock_prescaler prescaler)
+{
+    uint16_t cycles = scl_cycles >> prescaler;
+    // SCL = CPU clock / (16 + 2 * TWBR)
+    TWBR = cycles > 16 ? (cycles - 16) / 2 : 0;
+    return cycles >= 16;
+}
+
+/**
+ * @brief Waits for the current bus operation, giving up after a number of
+ * polling iterations.
+ * @return false if the timeout expired.
+ */
+static bool twi_wait_bounded(uint32_t loops)
+{
+    for (uint32_t i = 0; i < loops; i++)
+    {
+        if (bit_is_set(TWCR, TWINT)) return true;
+    }
+    return false;
+}
+
+bool twi_wait_timeout(void)
+{
+    if (twi_wait_bounded(TWI_TIMEOUT_LOOPS)) return true;
+    // Release the lines so a stuck bus does not block the next operation
+    TWCR = 0;
+    return false;
+}
+
+bool twi_probe(uint8_t sla)
+{
+    TWCR = TWI_SEND_START_CONDITION;
+    if (!twi_wait_bounded(TWI_PROBE_TIMEOUT_LOOPS) ||
+        (TW_STATUS != TW_START && TW_STATUS != TW_REP_START))
+    {
+        // Release the lines so a stuck bus does not block the next probe
+        TWCR = 0;
+        return false;
+    }
+
+    TWDR = TWI_SLA_WRITE(sla);
+    TWCR = TWI_TRANSMIT_BYTE;
+    if (!twi_wait_bounded(TWI_PROBE_TIMEOUT_LOOPS))
+    {
+        TWCR = 0;
+        return false;
+    }
+    bool ack = TW_STATUS == TW_MT_SLA_ACK;
+
+    twi_stop();
+    for (uint32_t i = 0; i < TWI_PROBE_TIMEOUT_LOOPS; i++)
+    {
+        if (bit_is_clear(TWCR, TWSTO)) return ack;
+    }
+    TWCR = 0;
+    return ack;
+}
+
+uint8_t twi_scan(uint8_t bitmap[TWI_SCAN_BITMAP_SIZE])
+{
+    uint8_t found = 0;
+    for (uint8_t i = 0; i < TWI_SCAN_BITMAP_SIZE; i++) bitmap[i] = 0;
+    for (uint8_t sla = TWI_FIRST_ADDRESS; sla <= TWI_LAST_ADDRESS; sla++)
+    {
+        if (twi_probe(sla))
+        {
+            bitmap[sla >> 3] |= _BV(sla & 0x07);
+            found++;
+        }
+    }
+    return found;
 }
 
 uint16_t twi_write(uint8_t sla, uint8_t *src, uint16_t length)
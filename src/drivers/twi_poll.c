@@ -0,0 +1,200 @@
+/**
+ * @file twi_poll.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 23:20
+ * @brief Periodic register polling engine built on the 2-wire serial interface
+ * driver.
+ */
+
+#include "drivers/twi.h"
+#include "drivers/twi_poll.h"
+
+/**
+ * @brief Bit periods taken by a start or stop condition and by a byte plus its
+ * acknowledge bit.
+ */
+#define CONDITION_BITS 1
+#define BYTE_BITS 9
+
+/**
+ * @brief Result of a job read.
+ */
+enum job_result
+{
+    JOB_DONE,
+    /** @brief The slave did not answer, the session can go on */
+    JOB_FAILED,
+    /** @brief Arbitration was lost, a bus error happened or a wait timed out */
+    JOB_BUS_LOST
+};
+
+static struct twi_poll_stats stats;
+
+// Set when a bus operation did not finish within TWI_TIMEOUT_US
+static bool timed_out;
+
+static inline bool is_due(const struct twi_poll_job *job, uint16_t now)
+{
+    return (int16_t)(now - job->due) >= 0;
+}
+
+/**
+ * @brief Generates a start or repeated start condition.
+ */
+static bool start(void)
+{
+    TWCR = TWI_SEND_START_CONDITION;
+    stats.bus_bits += CONDITION_BITS;
+    if (!twi_wait_timeout())
+    {
+        timed_out = true;
+        return false;
+    }
+    return TW_STATUS == TW_START || TW_STATUS == TW_REP_START;
+}
+
+static bool transmit(uint8_t data, uint8_t ack_status)
+{
+    TWDR = data;
+    TWCR = TWI_TRANSMIT_BYTE;
+    stats.bus_bits += BYTE_BITS;
+    if (!twi_wait_timeout())
+    {
+        timed_out = true;
+        return false;
+    }
+    return TW_STATUS == ack_status;
+}
+
+/**
+ * @brief Receives a byte, answering with ACK or, for the last one, NACK.
+ */
+static bool receive(uint8_t *dst, bool last)
+{
+    TWCR = last ? TWI_RECEIVE_LAST_BYTE : TWI_RECEIVE_BYTE;
+    if (!twi_wait_timeout())
+    {
+        timed_out = true;
+        return false;
+    }
+    *dst = TWDR;
+    return TW_STATUS == (last ? TW_MR_DATA_NACK : TW_MR_DATA_ACK);
+}
+
+/**
+ * @brief Classifies a failed address or register transfer.
+ */
+static enum job_result failure(uint8_t arb_lost_status)
+{
+    return timed_out || TW_STATUS == arb_lost_status ? JOB_BUS_LOST
+                                                     : JOB_FAILED;
+}
+
+/**
+ * @brief Writes the register address and reads the job into its back buffer.
+ * The bus is left owned so the next job starts with a repeated start.
+ */
+static enum job_result read_job(struct twi_poll_job *job)
+{
+    if (!start()) return JOB_BUS_LOST;
+    if (!transmit(TWI_SLA_WRITE(job->sla), TW_MT_SLA_ACK) ||
+        !transmit(job->reg, TW_MT_DATA_ACK))
+    {
+        return failure(TW_MT_ARB_LOST);
+    }
+    if (!start()) return JOB_BUS_LOST;
+    if (!transmit(TWI_SLA_READ(job->sla), TW_MR_SLA_ACK))
+    {
+        return failure(TW_MR_ARB_LOST);
+    }
+
+    uint8_t *dst = job->buffers + (job->front ? 0 : job->length);
+    uint8_t last = job->length - 1;
+    stats.bus_bits += (uint16_t)job->length * BYTE_BITS;
+    for (uint8_t i = 0; i <= last; i++)
+    {
+        if (!receive(&dst[i], i == last)) return JOB_BUS_LOST;
+    }
+
+    job->front ^= 1;
+    return JOB_DONE;
+}
+
+void twi_poll_init(struct twi_poll_job *jobs, uint8_t count, uint16_t now)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        jobs[i].front = 0;
+        jobs[i].due = now;
+        jobs[i].errors = 0;
+        jobs[i].valid = false;
+    }
+}
+
+uint8_t twi_poll_run(struct twi_poll_job *jobs, uint8_t count, uint16_t now)
+{
+    uint8_t done = 0;
+    bool session = false;
+    timed_out = false;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        struct twi_poll_job *job = &jobs[i];
+        if (!is_due(job, now)) continue;
+
+        // A zero length has no last byte to answer with NACK
+        enum job_result result = JOB_FAILED;
+        if (job->length > 0)
+        {
+            session = true;
+            result = read_job(job);
+        }
+        job->due += job->period;
+        // Do not try to catch up after falling behind
+        if (is_due(job, now)) job->due = now + job->period;
+
+        if (result == JOB_DONE)
+        {
+            job->updated = now;
+            job->valid = true;
+            done++;
+            continue;
+        }
+        if (job->errors < UINT8_MAX) job->errors++;
+        stats.errors++;
+        if (result == JOB_BUS_LOST) break;
+    }
+    if (session)
+    {
+        twi_stop();
+        stats.bus_bits += CONDITION_BITS;
+        stats.sessions++;
+    }
+    return done;
+}
+
+void twi_poll_take_stats(struct twi_poll_stats *dst)
+{
+    *dst = stats;
+    stats = (struct twi_poll_stats){0};
+}
+
+uint16_t twi_poll_utilization(const struct twi_poll_stats *src,
+                              uint32_t bit_rate, uint32_t elapsed_ms)
+{
+    // Bit periods available in the interval
+    uint32_t available = bit_rate / 1000 * elapsed_ms;
+    if (available == 0) return 0;
+    uint32_t utilization;
+    // Scale the divisor instead when bus_bits * 1000 does not fit in 32 bits
+    if (src->bus_bits > UINT32_MAX / 1000)
+    {
+        // Fewer than 1000 bit periods for that many bits is far above 100%
+        if (available < 1000) return UINT16_MAX;
+        utilization = src->bus_bits / (available / 1000);
+    }
+    else
+    {
+        utilization = src->bus_bits * 1000 / available;
+    }
+    return utilization > UINT16_MAX ? UINT16_MAX : (uint16_t)utilization;
+}
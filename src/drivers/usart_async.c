@@ -12,30 +12,42 @@
 #warning "Using F_CPU=16000000ul for baud rate calculation as it has not been defined."
 #endif /* !F_CPU */
 
+// Baud rate and clock divider, kept to retime USART0 on clock changes
+static uint32_t baud_rate;
+static uint8_t baud_divider;
+
 void usart_async_configure(struct usart_async_config config, uint32_t baudrate)
 {
-    UCSR0A = 0;
-    UCSR0B = (config.enable_tx << TXEN0) | (config.enable_rx << RXEN0);
-    UCSR0C = config.size | config.stop_bits | config.parity;
+    UCSR0A = (config.multi_processor << MPCM0) | (config.double_speed << U2X0);
+    UCSR0B = (config.enable_tx << TXEN0) | (config.enable_rx << RXEN0) |
+             (config.size >> USART_UCSZ02_OFFSET);
+    UCSR0C = (uint8_t)config.size | config.stop_bits | config.parity;
 
-    uint32_t br = (F_CPU / (16 * baudrate)) - 1;
-    UBRR0 = (uint16_t)br;
+    baud_rate = baudrate;
+    baud_divider = config.double_speed ? 8 : 16;
+    // UBRR0 is set for the current prescaler, not only for the undivided clock
+    usart_async_clock_changed(clock_get_prescaler());
 }
 
-void usart_async_write(uint8_t *src, uint16_t length)
+bool usart_async_clock_changed(enum clock_prescaler prescaler)
 {
-    for (uint16_t i = 0; i < length; i++) usart_transmit(*(src + i));
+    uint32_t clock = F_CPU >> prescaler;
+    uint32_t cycles = baud_divider * baud_rate;
+    // Nearest divisor, truncating gives up to one whole divisor step of error
+    uint32_t divisor = (clock + cycles / 2) / cycles;
+    if (divisor == 0) divisor = 1;
+    if (divisor > 4096) divisor = 4096;
+    UBRR0 = (uint16_t)(divisor - 1);
+
+    uint32_t actual = clock / (divisor * baud_divider);
+    uint32_t error = actual > baud_rate ? actual - baud_rate
+                                        : baud_rate - actual;
+    return error * 1000 / baud_rate <= USART_MAX_BAUD_ERROR;
 }
 
-uint16_t usart_async_read(uint8_t *dst, uint16_t length)
+void usart_async_write(uint8_t *src, uint16_t length)
 {
-    uint16_t i = 0;
-    for (i = 0; i < length; i++)
-    {
-        *(dst + i) = usart_receive();
-        if (USART_RX_ERROR) break;
-    }
-    return i;
+    for (uint16_t i = 0; i < length; i++) usart_transmit(*(src + i));
 }
 
 void usart_async_put_string(const char * str)
@@ -43,3 +55,9 @@ void usart_async_put_string(const char * str)
     uint16_t i = 0;
     while (*(str + i)) usart_transmit(*(str + i++));
 }
+
+void usart_async_write_to(uint8_t address, uint8_t *src, uint16_t length)
+{
+    usart_transmit_9bit(USART_ADDRESS_FRAME | address);
+    for (uint16_t i = 0; i < length; i++) usart_transmit_9bit(*(src + i));
+}
@@ -0,0 +1,32 @@
+/**
+ * @file usart_async_rx.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 13:10
+ * @brief Blocking receive functions of the USART0 driver. They are kept apart
+ * from usart_async.c so programs that only transmit do not link the receive
+ * wake-up handler when SDK_SLEEP_WAIT is defined.
+ */
+
+#include "drivers/usart_async.h"
+
+uint16_t usart_async_read(uint8_t *dst, uint16_t length)
+{
+    uint16_t i = 0;
+    for (i = 0; i < length; i++)
+    {
+        *(dst + i) = usart_receive();
+        if (USART_RX_ERROR) break;
+    }
+    return i;
+}
+
+void usart_async_listen(uint8_t address)
+{
+    usart_async_set_multi_processor(true);
+    uint16_t frame;
+    do
+    {
+        frame = usart_receive_9bit();
+    } while (frame != (USART_ADDRESS_FRAME | address));
+    usart_async_set_multi_processor(false);
+}
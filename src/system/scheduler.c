@@ -0,0 +1,322 @@
+/**
+ * @file scheduler.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 10:00
+ * @brief Cooperative run-to-completion event scheduler.
+ */
+
+#include <avr/io.h>
+#include <avr/sleep.h>
+#include <util/atomic.h>
+#include "system/scheduler.h"
+
+#ifndef F_CPU
+#define F_CPU 16000000ul
+#warning "Using F_CPU=16000000ul for tick calculation as it has not been defined."
+#endif /* !F_CPU */
+
+#if (SCHEDULER_QUEUE_SIZE & (SCHEDULER_QUEUE_SIZE - 1)) != 0
+#error "SCHEDULER_QUEUE_SIZE must be a power of two."
+#endif
+
+#define QUEUE_MASK (SCHEDULER_QUEUE_SIZE - 1)
+
+/**
+ * @brief Timer counts per tick, rounded, for a clock prescaler and a timer
+ * prescaler.
+ */
+#define TICK_COUNTS(P, DIV)                                                   \
+    (((F_CPU >> (P)) / (DIV) + SCHEDULER_TICK_HZ / 2) / SCHEDULER_TICK_HZ)
+
+/**
+ * @brief Timer/Counter 0 settings for a clock prescaler, the smallest timer
+ * prescaler whose tick fits in 8 bits is used.
+ */
+#define TICK_TIMING(P)                                                        \
+    {                                                                         \
+        .clock_select = TICK_COUNTS(P, 1) <= 256    ? _BV(CS00)              \
+                        : TICK_COUNTS(P, 8) <= 256  ? _BV(CS01)              \
+                        : TICK_COUNTS(P, 64) <= 256 ? _BV(CS01) | _BV(CS00)  \
+                                                    : _BV(CS02),             \
+        .counts = TICK_COUNTS(P, 1) <= 256    ? TICK_COUNTS(P, 1)            \
+                  : TICK_COUNTS(P, 8) <= 256  ? TICK_COUNTS(P, 8)            \
+                  : TICK_COUNTS(P, 64) <= 256 ? TICK_COUNTS(P, 64)           \
+                                              : TICK_COUNTS(P, 256)          \
+    }
+
+/**
+ * @brief Queued event.
+ */
+struct event
+{
+    event_handler_t handler;
+    uint8_t arg;
+    uint16_t posted_tick;
+    uint8_t posted_count;
+};
+
+/**
+ * @brief Single consumer ring buffer. Only the dispatcher writes head and only
+ * producers write tail.
+ */
+struct event_queue
+{
+    struct event events[SCHEDULER_QUEUE_SIZE];
+    volatile uint8_t head;
+    volatile uint8_t tail;
+};
+
+/**
+ * @brief Pending timer event.
+ */
+struct timer_event
+{
+    event_handler_t handler;
+    uint8_t arg;
+    uint8_t priority;
+    uint16_t deadline;
+};
+
+/**
+ * @brief Timer/Counter 0 configuration that generates the tick.
+ */
+struct tick_timing
+{
+    uint8_t clock_select;
+    uint16_t counts;
+};
+
+// Computed at compile time for every system clock prescaler
+static const struct tick_timing tick_timings[] = {
+    TICK_TIMING(CLOCK_DIV_1),   TICK_TIMING(CLOCK_DIV_2),
+    TICK_TIMING(CLOCK_DIV_4),   TICK_TIMING(CLOCK_DIV_8),
+    TICK_TIMING(CLOCK_DIV_16),  TICK_TIMING(CLOCK_DIV_32),
+    TICK_TIMING(CLOCK_DIV_64),  TICK_TIMING(CLOCK_DIV_128),
+    TICK_TIMING(CLOCK_DIV_256)
+};
+
+static struct event_queue queues[EVENT_PRIORITY_LEVELS];
+
+// Sorted by descending deadline, the next timer to expire is the last one
+static struct timer_event timers[SCHEDULER_MAX_TIMERS];
+static volatile uint8_t timer_count;
+
+static volatile uint16_t ticks;
+static uint16_t counts_per_tick;
+// Elapsed ticks above which the latency saturates, kept next to
+// counts_per_tick so dispatching does not divide
+static uint16_t latency_tick_limit;
+static struct scheduler_stats stats;
+
+/**
+ * @brief Reads the tick counter and the timer count as one timestamp.
+ */
+static void timestamp(uint16_t *tick, uint8_t *count)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        uint16_t t = ticks;
+        uint8_t c = TCNT0;
+        // Account for a compare match that has not been serviced yet
+        if (bit_is_set(TIFR0, OCF0A) && c < counts_per_tick / 2)
+        {
+            t++;
+        }
+        *tick = t;
+        *count = c;
+    }
+}
+
+/**
+ * @brief Compares two deadlines taking wrap-around into account.
+ */
+static inline bool deadline_before(uint16_t a, uint16_t b)
+{
+    return (int16_t)(a - b) < 0;
+}
+
+void scheduler_init(void)
+{
+    for (uint8_t i = 0; i < EVENT_PRIORITY_LEVELS; i++)
+    {
+        queues[i].head = 0;
+        queues[i].tail = 0;
+    }
+    timer_count = 0;
+    ticks = 0;
+    stats = (struct scheduler_stats){0};
+
+    // CTC mode
+    TCCR0A = _BV(WGM01);
+    // The prescaler may have been changed before or programmed by CKDIV8
+    scheduler_clock_changed(clock_get_prescaler());
+    TCNT0 = 0;
+    TIFR0 = _BV(OCF0A);
+    TIMSK0 = _BV(OCIE0A);
+}
+
+bool scheduler_post(event_handler_t handler, uint8_t arg,
+                    enum event_priority priority)
+{
+    struct event_queue *queue = &queues[priority];
+    bool queued = false;
+    // Interrupts do not nest, so this only guards against a post from the
+    // main loop being preempted by a post from an ISR
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        uint8_t tail = queue->tail;
+        uint8_t next = (tail + 1) & QUEUE_MASK;
+        if (next != queue->head)
+        {
+            struct event *event = &queue->events[tail];
+            event->handler = handler;
+            event->arg = arg;
+            timestamp(&event->posted_tick, &event->posted_count);
+            queue->tail = next;
+            queued = true;
+        }
+        else
+        {
+            stats.dropped++;
+        }
+    }
+    return queued;
+}
+
+bool scheduler_post_delayed(event_handler_t handler, uint8_t arg,
+                            enum event_priority priority, uint16_t delay)
+{
+    bool registered = false;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        if (timer_count < SCHEDULER_MAX_TIMERS)
+        {
+            uint16_t deadline = ticks + delay;
+            uint8_t i = timer_count;
+            // Insertion sort, later deadlines move towards the front
+            while (i > 0 && deadline_before(timers[i - 1].deadline, deadline))
+            {
+                timers[i] = timers[i - 1];
+                i--;
+            }
+            timers[i] = (struct timer_event){
+                .handler = handler,
+                .arg = arg,
+                .priority = priority,
+                .deadline = deadline
+            };
+            timer_count++;
+            registered = true;
+        }
+        else
+        {
+            stats.dropped++;
+        }
+    }
+    return registered;
+}
+
+bool scheduler_dispatch(void)
+{
+    for (uint8_t p = 0; p < EVENT_PRIORITY_LEVELS; p++)
+    {
+        struct event_queue *queue = &queues[p];
+        uint8_t head = queue->head;
+        if (head == queue->tail) continue;
+
+        struct event event = queue->events[head];
+        queue->head = (head + 1) & QUEUE_MASK;
+
+        uint16_t tick;
+        uint8_t count;
+        timestamp(&tick, &count);
+        uint16_t elapsed = tick - event.posted_tick;
+        uint16_t latency;
+        if (elapsed >= latency_tick_limit)
+        {
+            latency = UINT16_MAX;
+        }
+        else
+        {
+            latency = elapsed * counts_per_tick + count -
+                      event.posted_count;
+        }
+        if (latency > stats.max_latency) stats.max_latency = latency;
+        if (latency > SCHEDULER_LATENCY_BOUND) stats.overruns++;
+
+        event.handler(event.arg);
+        return true;
+    }
+    return false;
+}
+
+void scheduler_run(void)
+{
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    while (true)
+    {
+        if (scheduler_dispatch()) continue;
+
+        cli();
+        bool idle = true;
+        for (uint8_t p = 0; p < EVENT_PRIORITY_LEVELS; p++)
+        {
+            if (queues[p].head != queues[p].tail) idle = false;
+        }
+        if (idle)
+        {
+            // The instruction after sei is always executed, so an interrupt
+            // cannot slip in between the check and the sleep instruction
+            sleep_enable();
+            sei();
+            sleep_cpu();
+            sleep_disable();
+        }
+        sei();
+    }
+}
+
+uint16_t scheduler_ticks(void)
+{
+    uint16_t t;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        t = ticks;
+    }
+    return t;
+}
+
+bool scheduler_clock_changed(enum clock_prescaler prescaler)
+{
+    const struct tick_timing *timing = &tick_timings[prescaler];
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        counts_per_tick = timing->counts;
+        latency_tick_limit = UINT16_MAX / timing->counts;
+        TCCR0B = timing->clock_select;
+        OCR0A = timing->counts - 1;
+        // Keep the counter from running past the new compare value
+        if (TCNT0 > OCR0A) TCNT0 = 0;
+    }
+    return true;
+}
+
+void scheduler_get_stats(struct scheduler_stats *dst)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        *dst = stats;
+    }
+}
+
+ISR(TIMER0_COMPA_vect)
+{
+    uint16_t now = ++ticks;
+    while (timer_count > 0)
+    {
+        struct timer_event *timer = &timers[timer_count - 1];
+        if (deadline_before(now, timer->deadline)) break;
+        scheduler_post(timer->handler, timer->arg, timer->priority);
+        timer_count--;
+    }
+}
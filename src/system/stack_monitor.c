@@ -0,0 +1,118 @@
+/**
+ * @file stack_monitor.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 20:00
+ * @brief SRAM and stack usage instrumentation.
+ */
+
+#include <stdlib.h>
+#include <util/atomic.h>
+#include "drivers/usart_async.h"
+#include "system/stack_monitor.h"
+
+// Linker symbols, __brkval only exists when malloc is linked
+extern uint8_t _end;
+extern uint8_t __stack;
+extern uint8_t *__brkval __attribute__((weak));
+
+volatile uint16_t stack_monitor_peaks[STACK_MONITOR_SLOTS];
+
+// Deepest stack address used before STACK_MONITOR_ISR_BEGIN painted it again
+static volatile uint16_t lowest_used = RAMEND + 1;
+
+/**
+ * @brief Paints the SRAM from the end of the static data to the top of the
+ * stack. It runs from .init1, before the stack is used and before r1 is
+ * cleared, so it is written in assembly.
+ */
+void stack_monitor_paint(void)
+    __attribute__((naked, used, section(".init1")));
+
+void stack_monitor_paint(void)
+{
+    __asm__ volatile(
+        "    ldi r30, lo8(_end)\n"
+        "    ldi r31, hi8(_end)\n"
+        "    ldi r24, %0\n"
+        "    ldi r25, hi8(__stack)\n"
+        "    rjmp 2f\n"
+        "1:  st Z+, r24\n"
+        "2:  cpi r30, lo8(__stack)\n"
+        "    cpc r31, r25\n"
+        "    brlo 1b\n"
+        "    breq 1b\n"
+        :
+        : "i"(STACK_MONITOR_CANARY));
+}
+
+/**
+ * @brief Gets the first address above the static data and the heap.
+ */
+static uint8_t *heap_end(void)
+{
+    uint8_t *end = &_end;
+    if (&__brkval && __brkval > end) end = __brkval;
+    return end;
+}
+
+uint16_t stack_monitor_isr_begin(uint16_t entry_sp)
+{
+    uint16_t bottom = entry_sp - STACK_MONITOR_ISR_WINDOW + 1;
+    uint16_t end = (uint16_t)heap_end();
+    if (bottom < end) bottom = end;
+
+    // The first used address of the window is the deepest one
+    uint16_t p = bottom;
+    while (p <= entry_sp && *(volatile uint8_t *)p == STACK_MONITOR_CANARY) p++;
+    if (p < lowest_used) lowest_used = p;
+    return bottom;
+}
+
+void stack_monitor_get(struct stack_usage *usage)
+{
+    uint8_t *end = heap_end();
+    uint8_t *p = end;
+    while (p <= &__stack && *p == STACK_MONITOR_CANARY) p++;
+
+    uint16_t sp;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        sp = SP;
+        if (lowest_used < (uint16_t)p) p = (uint8_t *)lowest_used;
+    }
+    usage->peak = (uint16_t)&__stack - (uint16_t)p + 1;
+    usage->current = (uint16_t)&__stack - sp;
+    usage->free = sp - (uint16_t)end;
+    usage->min_free = (uint16_t)p - (uint16_t)end;
+}
+
+/**
+ * @brief Transmits a label followed by a decimal number.
+ */
+static void put_field(const char *label, uint16_t value)
+{
+    char digits[6];
+    usart_async_put_string(label);
+    usart_async_put_string(utoa(value, digits, 10));
+}
+
+void stack_monitor_report(void)
+{
+    struct stack_usage usage;
+    stack_monitor_get(&usage);
+    put_field("stack peak=", usage.peak);
+    put_field(" current=", usage.current);
+    put_field(" free=", usage.free);
+    put_field(" min_free=", usage.min_free);
+    for (uint8_t i = 0; i < STACK_MONITOR_SLOTS; i++)
+    {
+        uint16_t peak;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            peak = stack_monitor_peaks[i];
+        }
+        put_field(" slot", i);
+        put_field("=", peak);
+    }
+    usart_async_put_string("\n");
+}
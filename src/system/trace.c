@@ -0,0 +1,84 @@
+/**
+ * @file trace.c
+ * @author Iván Santiago (https://github.com/ivanstgo)
+ * @date 19/10/2026 - 17:20
+ * @brief Deferred binary trace logging.
+ */
+
+#include <avr/io.h>
+#include <util/atomic.h>
+#include "system/trace.h"
+
+#if (TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1)) != 0
+#error "TRACE_BUFFER_SIZE must be a power of two."
+#endif
+
+#define BUFFER_MASK (TRACE_BUFFER_SIZE - 1)
+
+// Without tools/trace/trace.ld, .trace_fmt would be loaded into flash and the
+// message IDs would be load addresses. Only the fragment defines this symbol,
+// the reference lives in a section that is not loaded.
+__asm__(".pushsection .trace_check,\"\",@progbits\n"
+        ".long __trace_fmt_start\n"
+        ".popsection");
+
+/**
+ * @brief Length byte and message ID.
+ */
+#define RECORD_HEADER_SIZE 3
+
+static uint8_t buffer[TRACE_BUFFER_SIZE];
+static volatile uint8_t head;
+static volatile uint8_t tail;
+static volatile uint16_t dropped;
+
+void trace_record(uint16_t id, const void *args, uint8_t length)
+{
+    const uint8_t *src = (const uint8_t *)args;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        uint8_t t = tail;
+        uint8_t space = (head - t - 1) & BUFFER_MASK;
+        if (space < length + RECORD_HEADER_SIZE)
+        {
+            dropped++;
+        }
+        else
+        {
+            buffer[t] = length + 2;
+            t = (t + 1) & BUFFER_MASK;
+            buffer[t] = (uint8_t)id;
+            t = (t + 1) & BUFFER_MASK;
+            buffer[t] = (uint8_t)(id >> 8);
+            t = (t + 1) & BUFFER_MASK;
+            for (uint8_t i = 0; i < length; i++)
+            {
+                buffer[t] = *(src + i);
+                t = (t + 1) & BUFFER_MASK;
+            }
+            tail = t;
+        }
+    }
+}
+
+void trace_flush(void)
+{
+    // Only this function writes head, records are never split by producers
+    uint8_t h = head;
+    while (h != tail && bit_is_set(UCSR0A, UDRE0))
+    {
+        UDR0 = buffer[h];
+        h = (h + 1) & BUFFER_MASK;
+        head = h;
+    }
+}
+
+uint16_t trace_dropped(void)
+{
+    uint16_t d;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        d = dropped;
+    }
+    return d;
+}
@@ -14,6 +14,10 @@ set(CMAKE_C_COMPILER avr-gcc)
 set(CMAKE_ASM_COMPILER avr-as)
 # Set C++ compiler
 set(CMAKE_CXX_COMPILER avr-g++)
+# Set size tool
+set(CMAKE_SIZE avr-size)
 
 # Global C compiler flags
 set(CMAKE_C_FLAGS_INIT "-mmcu=atmega328p")
+# Global C++ compiler flags
+set(CMAKE_CXX_FLAGS_INIT "-mmcu=atmega328p -fno-exceptions -fno-rtti -fno-threadsafe-statics")
@@ -41,6 +41,19 @@ function(generate_sym TARGET)
     VERBATIM)
 endfunction()
 
+# @brief Fails the build if the flash image is larger than a limit
+# @param TARGET target
+# @param MAX_SIZE limit in bytes
+function(check_size TARGET MAX_SIZE)
+  add_custom_command(
+    TARGET ${TARGET}
+    POST_BUILD
+    COMMAND ${CMAKE_OBJCOPY} -O binary -R .eeprom ${TARGET} ${TARGET}.bin
+    COMMAND ${CMAKE_COMMAND} -DFILE=${TARGET}.bin -DMAX_SIZE=${MAX_SIZE} -P
+            ${CMAKE_CURRENT_FUNCTION_LIST_DIR}/check-size.cmake
+    VERBATIM)
+endfunction()
+
 # @brief Adds a custom target to flash the microcontroller using avrdude
 # @param TARGET target
 function(add_avrdude_target TARGET)
@@ -50,3 +63,22 @@ function(add_avrdude_target TARGET)
     COMMAND avrdude -p atmega328p -P /dev/ttyACM0 -c arduino -v -U
             flash:w:${TARGET}.hex)
 endfunction()
+
+# @brief Adds a custom target to flash the microcontroller through the SDK
+# bootloader
+# @param TARGET target
+function(add_sdk_flash_target TARGET)
+  add_custom_target(
+    sdk_flash_${TARGET}
+    DEPENDS ${TARGET}.hex
+    COMMAND python3 ${CMAKE_CURRENT_FUNCTION_LIST_DIR}/../flasher/sdk_flash.py
+            -P /dev/ttyACM0 ${TARGET}.hex)
+endfunction()
+
+# @brief Links the trace library and keeps trace format strings out of flash
+# @param TARGET target
+function(enable_trace TARGET)
+  target_link_libraries(${TARGET} trace)
+  target_link_options(${TARGET} PUBLIC
+    LINKER:-T,${CMAKE_CURRENT_FUNCTION_LIST_DIR}/../trace/trace.ld)
+endfunction()
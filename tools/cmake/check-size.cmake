@@ -0,0 +1,14 @@
+# @file check-size.cmake
+# @author Iván Santiago (https://github.com/ivanstgo)
+# @date 19/10/2026 - 21:20
+# @brief Script that fails if a binary file is larger than a limit
+# @param FILE binary file
+# @param MAX_SIZE limit in bytes
+
+cmake_minimum_required(VERSION 3.30)
+
+file(SIZE ${FILE} SIZE)
+if(SIZE GREATER MAX_SIZE)
+  message(FATAL_ERROR "${FILE} is ${SIZE} bytes, the limit is ${MAX_SIZE} bytes")
+endif()
+message(STATUS "${FILE}: ${SIZE}/${MAX_SIZE} bytes")
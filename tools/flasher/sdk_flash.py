@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+# @file sdk_flash.py
+# @author Iván Santiago (https://github.com/ivanstgo)
+# @date 19/10/2026 - 21:20
+# @brief Host flasher for the SDK bootloader. It streams an Intel HEX image
+# page by page, skips the pages whose CRC already matches and verifies each
+# programmed page with the CRC read back by the bootloader.
+#
+# Usage:
+#   sdk_flash.py -P /dev/ttyACM0 firmware.hex
+
+import argparse
+import fcntl
+import os
+import select
+import struct
+import sys
+import termios
+import time
+
+BAUD_RATE = termios.B1000000
+SIGNATURE = bytes([0x1E, 0x95, 0x0F])
+BOOTLOADER_START = 0x7C00
+REPLY_OK = b"K"
+
+
+class FlashError(Exception):
+    pass
+
+
+def crc_xmodem(data, crc=0):
+    """CRC-16/XMODEM, same as _crc_xmodem_update from avr-libc."""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def read_hex(path):
+    """Returns a {address: byte} map with the contents of an Intel HEX file."""
+    memory = {}
+    base = 0
+    with open(path) as hex_file:
+        for number, line in enumerate(hex_file, 1):
+            line = line.strip()
+            if not line:
+                continue
+            if not line.startswith(":"):
+                raise FlashError(f"{path}:{number}: invalid record")
+            record = bytes.fromhex(line[1:])
+            if sum(record) & 0xFF:
+                raise FlashError(f"{path}:{number}: bad checksum")
+            length, address, kind = record[0], (record[1] << 8) | record[2], record[3]
+            data = record[4:4 + length]
+            if kind == 0x00:
+                for i, byte in enumerate(data):
+                    memory[base + address + i] = byte
+            elif kind == 0x01:
+                break
+            elif kind == 0x02:
+                base = ((data[0] << 8) | data[1]) << 4
+            elif kind == 0x04:
+                base = ((data[0] << 8) | data[1]) << 16
+    return memory
+
+
+def pages(memory, page_size):
+    """Splits the image into pages, unused bytes are left erased."""
+    result = {}
+    for address, byte in memory.items():
+        start = address - address % page_size
+        page = result.setdefault(start, bytearray(b"\xff" * page_size))
+        page[address - start] = byte
+    return dict(sorted(result.items()))
+
+
+class Port:
+    def __init__(self, path, timeout):
+        self.timeout = timeout
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        attrs = termios.tcgetattr(self.fd)
+        attrs[0] = 0                                    # iflag
+        attrs[1] = 0                                    # oflag
+        attrs[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+        attrs[3] = 0                                    # lflag
+        attrs[4] = attrs[5] = BAUD_RATE
+        attrs[6][termios.VMIN] = 0
+        attrs[6][termios.VTIME] = 0
+        termios.tcsetattr(self.fd, termios.TCSANOW, attrs)
+
+    def reset(self):
+        """Pulses DTR, which resets boards with an auto-reset circuit."""
+        dtr = struct.pack("I", termios.TIOCM_DTR)
+        fcntl.ioctl(self.fd, termios.TIOCMBIC, dtr)
+        time.sleep(0.05)
+        fcntl.ioctl(self.fd, termios.TIOCMBIS, dtr)
+        time.sleep(0.05)
+        termios.tcflush(self.fd, termios.TCIOFLUSH)
+
+    def write(self, data):
+        os.write(self.fd, data)
+
+    def read(self, length):
+        data = b""
+        deadline = time.monotonic() + self.timeout
+        while len(data) < length:
+            remaining = deadline - time.monotonic()
+            if remaining <= 0 or not select.select([self.fd], [], [], remaining)[0]:
+                raise FlashError("timeout waiting for the bootloader")
+            data += os.read(self.fd, length - len(data))
+        return data
+
+    def close(self):
+        os.close(self.fd)
+
+
+def expect_ok(port):
+    reply = port.read(1)
+    if reply != REPLY_OK:
+        raise FlashError(f"bootloader replied {reply!r}")
+
+
+def sync(port, attempts):
+    for _ in range(attempts):
+        port.write(b"S")
+        try:
+            expect_ok(port)
+            reply = port.read(4)
+        except FlashError:
+            termios.tcflush(port.fd, termios.TCIFLUSH)
+            continue
+        if reply[:3] != SIGNATURE:
+            raise FlashError(f"unexpected device signature {reply[:3].hex()}")
+        return reply[3]
+    raise FlashError("the bootloader did not answer")
+
+
+def page_crc(port, address):
+    port.write(b"C" + struct.pack("<H", address))
+    expect_ok(port)
+    return struct.unpack("<H", port.read(2))[0]
+
+
+def write_page(port, address, data):
+    crc = crc_xmodem(data)
+    port.write(b"W" + struct.pack("<H", address) + data + struct.pack("<H", crc))
+    expect_ok(port)
+    if struct.unpack("<H", port.read(2))[0] != crc:
+        raise FlashError(f"verification failed at 0x{address:04x}")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Flashes an Intel HEX file through the SDK bootloader")
+    parser.add_argument("-P", "--port", default="/dev/ttyACM0",
+                        help="serial port, e.g. a simavr UART pty")
+    parser.add_argument("--no-reset", action="store_true",
+                        help="do not pulse DTR before connecting")
+    parser.add_argument("--timeout", type=float, default=1.0,
+                        help="reply timeout in seconds")
+    parser.add_argument("hex", help="Intel HEX file")
+    args = parser.parse_args()
+
+    try:
+        memory = read_hex(args.hex)
+        port = Port(args.port, args.timeout)
+        try:
+            if not args.no_reset:
+                port.reset()
+            page_size = sync(port, attempts=20)
+            image = pages(memory, page_size)
+            if image and max(image) >= BOOTLOADER_START:
+                raise FlashError("the image overlaps the boot section")
+
+            written = 0
+            start = time.monotonic()
+            for address, data in image.items():
+                if page_crc(port, address) == crc_xmodem(data):
+                    continue
+                write_page(port, address, data)
+                written += 1
+            port.write(b"Q")
+            expect_ok(port)
+        finally:
+            port.close()
+    except (FlashError, OSError) as error:
+        sys.exit(f"sdk_flash: {error}")
+
+    print(f"{len(image)} pages, {written} written, {len(image) - written} "
+          f"unchanged, {time.monotonic() - start:.2f} s")
+
+
+if __name__ == "__main__":
+    main()
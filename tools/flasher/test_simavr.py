@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+# @file test_simavr.py
+# @author Iván Santiago (https://github.com/ivanstgo)
+# @date 19/10/2026 - 21:20
+# @brief End-to-end test of the SDK bootloader and sdk_flash.py under simavr.
+# It boots the bootloader in simavr's simduino board, which exposes USART0 as
+# a pty and keeps the flash in a file between runs, and then:
+#   1. programs an application and checks that pages were written,
+#   2. flashes the same image again and checks that every page is skipped,
+#      which also verifies the whole image against the CRC of each page.
+#
+# Usage:
+#   test_simavr.py --simduino simduino.elf bootloader.hex application.hex
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+FLASHER = os.path.join(os.path.dirname(os.path.abspath(__file__)), "sdk_flash.py")
+UART_PTY = "/tmp/simavr-uart0"
+RESULT = re.compile(r"(\d+) pages, (\d+) written, (\d+) unchanged")
+
+
+class TestError(Exception):
+    pass
+
+
+def boot(simduino, bootloader, workdir):
+    """Starts simduino and waits for its UART pty."""
+    if os.path.lexists(UART_PTY):
+        os.unlink(UART_PTY)
+    process = subprocess.Popen([simduino, os.path.abspath(bootloader)],
+                               cwd=workdir, stdout=subprocess.DEVNULL,
+                               stderr=subprocess.DEVNULL)
+    deadline = time.monotonic() + 5
+    while not os.path.exists(UART_PTY):
+        if process.poll() is not None or time.monotonic() > deadline:
+            process.kill()
+            raise TestError("simduino did not create its UART pty")
+        time.sleep(0.01)
+    return process
+
+
+def flash(simduino, bootloader, application, workdir):
+    """Runs the flasher against a fresh simulator, returns (pages, written)."""
+    process = boot(simduino, bootloader, workdir)
+    try:
+        result = subprocess.run(
+            [sys.executable, FLASHER, "-P", UART_PTY, "--no-reset",
+             "--timeout", "2", application],
+            capture_output=True, text=True, timeout=120)
+    finally:
+        process.kill()
+        process.wait()
+    output = result.stdout + result.stderr
+    match = RESULT.search(output)
+    if result.returncode != 0 or not match:
+        raise TestError(f"flasher failed: {output.strip()}")
+    print(output.strip())
+    return int(match.group(1)), int(match.group(2))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Tests the SDK bootloader and flasher under simavr")
+    parser.add_argument("--simduino", default="simduino.elf",
+                        help="simavr simduino board executable")
+    parser.add_argument("bootloader", help="bootloader Intel HEX file")
+    parser.add_argument("application", help="application Intel HEX file")
+    args = parser.parse_args()
+
+    try:
+        with tempfile.TemporaryDirectory() as workdir:
+            pages, written = flash(args.simduino, args.bootloader,
+                                   args.application, workdir)
+            if pages == 0 or written != pages:
+                raise TestError(f"expected {pages} pages to be written, "
+                                f"{written} were")
+            pages, written = flash(args.simduino, args.bootloader,
+                                   args.application, workdir)
+            if written != 0:
+                raise TestError(f"expected every page to be unchanged, "
+                                f"{written} were written")
+    except (TestError, OSError, subprocess.TimeoutExpired) as error:
+        sys.exit(f"test_simavr: {error}")
+    print("test_simavr: passed")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+# @file trace_decode.py
+# @author Iván Santiago (https://github.com/ivanstgo)
+# @date 19/10/2026 - 17:20
+# @brief Rebuilds trace messages from a .elf file and the byte stream emitted
+# by the trace library.
+#
+# Usage:
+#   stty -F /dev/ttyACM0 raw 115200
+#   trace_decode.py firmware.elf /dev/ttyACM0
+
+import argparse
+import re
+import struct
+import sys
+
+SECTION_NAME = ".trace_fmt"
+
+# printf conversion: flags, width, precision, length modifier and conversion
+CONVERSION = re.compile(r"%([-+ #0]*\d*(?:\.\d+)?)(hh|h|ll|l)?([diouxXcf%])")
+
+# Argument size on the AVR for each length modifier
+INTEGER_SIZES = {"hh": 1, "h": 2, "": 2, "l": 4, "ll": 8}
+UNPACK_FORMATS = {1: "b", 2: "h", 4: "i", 8: "q"}
+
+
+def read_section(path, name):
+    """Returns the contents of an ELF32 section."""
+    with open(path, "rb") as elf:
+        data = elf.read()
+    if data[:4] != b"\x7fELF" or data[4] != 1:
+        raise ValueError(f"{path} is not an ELF32 file")
+    shoff, = struct.unpack_from("<I", data, 0x20)
+    shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x2E)
+
+    def header(index):
+        return struct.unpack_from("<IIIIIIIIII", data, shoff + index * shentsize)
+
+    strtab_offset = header(shstrndx)[4]
+    for i in range(shnum):
+        sh_name, _, _, _, sh_offset, sh_size = header(i)[:6]
+        end = data.index(b"\0", strtab_offset + sh_name)
+        if data[strtab_offset + sh_name:end].decode() == name:
+            return data[sh_offset:sh_offset + sh_size]
+    raise ValueError(f"{path} has no {name} section, was enable_trace used?")
+
+
+def format_string(strings, message_id):
+    end = strings.index(b"\0", message_id)
+    return strings[message_id:end].decode("ascii", errors="replace")
+
+
+def render(fmt, args):
+    """Formats the raw argument bytes according to the format string."""
+    if "%" in CONVERSION.sub("", fmt):
+        return f"{fmt} <unsupported conversion {args.hex()}>"
+    values = []
+    offset = 0
+    for flags, length, conversion in CONVERSION.findall(fmt):
+        if conversion == "%":
+            continue
+        if conversion == "f":
+            size, code = 4, "f"
+        elif conversion == "c":
+            size, code = INTEGER_SIZES[length or "hh"], "B"
+        else:
+            size = INTEGER_SIZES[length]
+            code = UNPACK_FORMATS[size]
+            if conversion not in "di":
+                code = code.upper()
+        if offset + size > len(args):
+            return f"{fmt} <truncated arguments {args.hex()}>"
+        values.append(struct.unpack_from("<" + code, args, offset)[0])
+        offset += size
+    if offset != len(args):
+        return f"{fmt} <argument size mismatch {args.hex()}>"
+    # Python ignores C length modifiers except h, l and L
+    python_fmt = CONVERSION.sub(lambda m: "%" + m.group(1) + m.group(3), fmt)
+    try:
+        return python_fmt % tuple(values)
+    except (TypeError, ValueError) as error:
+        return f"{fmt} <{error} {args.hex()}>"
+
+
+def decode(strings, stream, output):
+    while True:
+        header = stream.read(1)
+        if not header:
+            return
+        length = header[0]
+        record = stream.read(length)
+        if len(record) < length or length < 2:
+            output.write("<incomplete record>\n")
+            return
+        message_id, = struct.unpack_from("<H", record)
+        if message_id >= len(strings):
+            output.write(f"<unknown message id {message_id}>\n")
+            continue
+        output.write(render(format_string(strings, message_id), record[2:]))
+        output.write("\n")
+        output.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Decodes the trace byte stream of a firmware image")
+    parser.add_argument("elf", help="firmware .elf file")
+    parser.add_argument("input", nargs="?", help="byte stream, stdin by default")
+    args = parser.parse_args()
+
+    strings = read_section(args.elf, SECTION_NAME)
+    if args.input:
+        with open(args.input, "rb", buffering=0) as stream:
+            decode(strings, stream, sys.stdout)
+    else:
+        decode(strings, sys.stdin.buffer, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()